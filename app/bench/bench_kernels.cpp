@@ -0,0 +1,554 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/**
+ * @file bench_kernels.cpp
+ * @brief Micro-benchmarks of the kernels used in the hot paths of the
+ *        application.
+ *
+ * Every kernel is swept across a list of input sizes. Each benchmark is run
+ * with an increasing number of iterations until it takes at least the
+ * configured minimum time, and the average time per iteration is reported.
+ *
+ * Results can be written to a JSON file that follows the layout used by
+ * Google Benchmark (`context` & `benchmarks` objects), so that existing
+ * comparison scripts can be used to compare two runs.
+ */
+
+#include <QFile>
+#include <QDateTime>
+#include <QJsonArray>
+#include <QJsonObject>
+#include <QTextStream>
+#include <QJsonDocument>
+#include <QSysInfo>
+#include <QThread>
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QRegularExpression>
+
+#include <cmath>
+#include <chrono>
+#include <ctime>
+#include <vector>
+
+#include "IO/Checksum.h"
+#include "IO/CircularBuffer.h"
+#include "IO/Console.h"
+#include "JSON/BinaryDecoder.h"
+#include "JSON/FieldSplitter.h"
+#include "JSON/FrameScript.h"
+#include "SIMD/SIMD.h"
+#include "UI/Dashboard.h"
+
+//------------------------------------------------------------------------------
+// Benchmark harness
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Prevents the compiler from optimizing away the computation of
+ *        @a value.
+ */
+template<typename T>
+inline void doNotOptimize(T &&value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : "g"(&value) : "memory");
+#else
+  static const void *volatile sink;
+  sink = &value;
+#endif
+}
+
+/**
+ * @brief Result of a single benchmark.
+ */
+struct Result
+{
+  QString name;
+  qint64 iterations = 0;
+  double realTime = 0;       /**< Wall time per iteration (ns). */
+  double cpuTime = 0;        /**< CPU time per iteration (ns). */
+  double bytesPerSecond = 0; /**< Throughput, 0 if not applicable. */
+};
+
+/**
+ * @brief Runs the registered benchmarks and collects their results.
+ */
+class Runner
+{
+public:
+  Runner(const QRegularExpression &filter, const double minTime)
+    : m_minTime(minTime)
+    , m_filter(filter)
+    , m_out(stdout)
+  {
+    m_out << QStringLiteral("%1%2%3%4\n")
+                 .arg(QStringLiteral("Benchmark"), -40)
+                 .arg(QStringLiteral("Time (ns)"), 14)
+                 .arg(QStringLiteral("Iterations"), 14)
+                 .arg(QStringLiteral("Throughput"), 16);
+    m_out.flush();
+  }
+
+  /**
+   * @brief Runs the benchmark @a name, which processes @a bytes bytes on each
+   *        call to @a function.
+   */
+  template<typename Function>
+  void run(const QString &name, const qint64 bytes, Function &&function)
+  {
+    if (!m_filter.match(name).hasMatch())
+      return;
+
+    // Warm up caches & branch predictors
+    function();
+
+    // Increase the iterations until the benchmark runs long enough
+    qint64 iterations = 1;
+    double realTime = 0;
+    double cpuTime = 0;
+    while (true)
+    {
+      const auto cpuStart = std::clock();
+      const auto start = std::chrono::steady_clock::now();
+      for (qint64 i = 0; i < iterations; ++i)
+        function();
+
+      const auto end = std::chrono::steady_clock::now();
+      const auto cpuEnd = std::clock();
+
+      realTime = std::chrono::duration<double>(end - start).count();
+      cpuTime = static_cast<double>(cpuEnd - cpuStart) / CLOCKS_PER_SEC;
+      if (realTime >= m_minTime || iterations >= (qint64(1) << 40))
+        break;
+
+      // Estimate the iterations needed to reach the minimum time
+      const auto factor = realTime > 0 ? 1.4 * m_minTime / realTime : 10;
+      iterations = static_cast<qint64>(iterations * qBound(2.0, factor, 10.0));
+    }
+
+    // Register result
+    Result result;
+    result.name = name;
+    result.iterations = iterations;
+    result.realTime = realTime * 1e9 / iterations;
+    result.cpuTime = cpuTime * 1e9 / iterations;
+    if (bytes > 0)
+      result.bytesPerSecond = bytes * iterations / realTime;
+
+    m_results.push_back(result);
+
+    // Print result
+    QString throughput;
+    if (result.bytesPerSecond > 0)
+    {
+      const auto mib = result.bytesPerSecond / (1024 * 1024);
+      throughput = QStringLiteral("%1 MiB/s").arg(mib, 0, 'f', 1);
+    }
+
+    m_out << QStringLiteral("%1%2%3%4\n")
+                 .arg(name, -40)
+                 .arg(result.realTime, 14, 'f', 1)
+                 .arg(result.iterations, 14)
+                 .arg(throughput, 16);
+    m_out.flush();
+  }
+
+  /**
+   * @brief Writes the results to a JSON file at @a path.
+   */
+  bool writeJson(const QString &path) const
+  {
+    QJsonObject context;
+    context.insert(QStringLiteral("date"),
+                   QDateTime::currentDateTime().toString(Qt::ISODate));
+    context.insert(QStringLiteral("host_name"), QSysInfo::machineHostName());
+    context.insert(QStringLiteral("executable"),
+                   QCoreApplication::applicationFilePath());
+    context.insert(QStringLiteral("num_cpus"), QThread::idealThreadCount());
+    context.insert(QStringLiteral("cpu_architecture"),
+                   QSysInfo::currentCpuArchitecture());
+#ifdef NDEBUG
+    context.insert(QStringLiteral("library_build_type"),
+                   QStringLiteral("release"));
+#else
+    context.insert(QStringLiteral("library_build_type"),
+                   QStringLiteral("debug"));
+#endif
+
+    QJsonArray benchmarks;
+    for (const auto &result : m_results)
+    {
+      QJsonObject object;
+      object.insert(QStringLiteral("name"), result.name);
+      object.insert(QStringLiteral("run_name"), result.name);
+      object.insert(QStringLiteral("run_type"), QStringLiteral("iteration"));
+      object.insert(QStringLiteral("iterations"), result.iterations);
+      object.insert(QStringLiteral("real_time"), result.realTime);
+      object.insert(QStringLiteral("cpu_time"), result.cpuTime);
+      object.insert(QStringLiteral("time_unit"), QStringLiteral("ns"));
+      if (result.bytesPerSecond > 0)
+        object.insert(QStringLiteral("bytes_per_second"),
+                      result.bytesPerSecond);
+
+      benchmarks.append(object);
+    }
+
+    QJsonObject document;
+    document.insert(QStringLiteral("context"), context);
+    document.insert(QStringLiteral("benchmarks"), benchmarks);
+
+    QFile file(path);
+    if (!file.open(QFile::WriteOnly))
+      return false;
+
+    file.write(QJsonDocument(document).toJson(QJsonDocument::Indented));
+    return true;
+  }
+
+private:
+  double m_minTime;
+  QRegularExpression m_filter;
+  QTextStream m_out;
+  std::vector<Result> m_results;
+};
+
+//------------------------------------------------------------------------------
+// Input data
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Generates @a size bytes that look like comma-separated sensor data,
+ *        with a line break every 64 bytes.
+ */
+static QByteArray generateText(const qsizetype size)
+{
+  static const QByteArray pattern
+      = QByteArrayLiteral("123.45,-67.89,0.001,42,3.14159,2.71828,1000.0,-1");
+
+  QByteArray data;
+  data.reserve(size);
+  while (data.size() < size)
+  {
+    data.append(pattern);
+    data.append('\n');
+  }
+
+  data.truncate(size);
+  return data;
+}
+
+/**
+ * @brief Generates @a size bytes of binary data with every byte value.
+ */
+static QByteArray generateBinary(const qsizetype size)
+{
+  QByteArray data(size, Qt::Uninitialized);
+  for (qsizetype i = 0; i < size; ++i)
+    data[i] = static_cast<char>((i * 131 + 7) & 0xFF);
+
+  return data;
+}
+
+/**
+ * @brief Generates @a count samples of a noisy sine wave.
+ */
+static std::vector<double> generateSamples(const size_t count)
+{
+  std::vector<double> data(count);
+  for (size_t i = 0; i < count; ++i)
+    data[i] = std::sin(i * 0.01) * 100 + static_cast<double>(i % 7);
+
+  return data;
+}
+
+//------------------------------------------------------------------------------
+// Benchmarks
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Benchmarks the circular buffer that holds the data of the frame
+ *        readers.
+ */
+static void benchCircularBuffer(Runner &runner, const QList<qsizetype> &sizes)
+{
+  for (const auto size : sizes)
+  {
+    const auto data = generateText(size);
+    const auto suffix = QStringLiteral("/%1").arg(size);
+    IO::CircularBuffer<QByteArray, char> buffer(size * 4);
+
+    // Append a chunk, and drop it without copying to make room for the next
+    runner.run(QStringLiteral("CircularBuffer/append") + suffix, size, [&] {
+      doNotOptimize(buffer.append(data));
+      buffer.skip(size);
+    });
+
+    // Append a chunk, and copy it out
+    buffer.clear();
+    runner.run(QStringLiteral("CircularBuffer/read") + suffix, size, [&] {
+      (void)buffer.append(data);
+      auto copy = buffer.read(size);
+      doNotOptimize(copy);
+    });
+
+    // Copy a chunk without consuming it, start at the middle of the storage
+    // so that the copy wraps around
+    buffer.clear();
+    (void)buffer.append(generateText(size * 3 + size / 2));
+    buffer.skip(size * 3 + size / 2);
+    (void)buffer.append(data);
+    runner.run(QStringLiteral("CircularBuffer/peek") + suffix, size, [&] {
+      auto copy = buffer.peek(size);
+      doNotOptimize(copy);
+    });
+
+    // Search for a pattern located at the end of the data
+    buffer.clear();
+    const auto pattern = QByteArrayLiteral("$END;");
+    (void)buffer.append(data.left(size - pattern.size()) + pattern);
+    runner.run(QStringLiteral("CircularBuffer/findPatternKMP") + suffix, size,
+               [&] { doNotOptimize(buffer.findPatternKMP(pattern)); });
+  }
+}
+
+/**
+ * @brief Benchmarks the SIMD kernels used by the dashboard plots.
+ */
+static void benchSIMD(Runner &runner, const QList<qsizetype> &sizes)
+{
+  for (const auto size : sizes)
+  {
+    const auto count = static_cast<size_t>(size);
+    const auto bytes = size * static_cast<qint64>(sizeof(double));
+    const auto suffix = QStringLiteral("/%1").arg(size);
+    auto data = generateSamples(count);
+
+    runner.run(QStringLiteral("SIMD/fill") + suffix, bytes, [&] {
+      SIMD::fill<double>(data.data(), count, 1.5);
+      doNotOptimize(data);
+    });
+
+    runner.run(QStringLiteral("SIMD/fill_range") + suffix, bytes, [&] {
+      SIMD::fill_range<double>(data.data(), count, 0);
+      doNotOptimize(data);
+    });
+
+    runner.run(QStringLiteral("SIMD/shift") + suffix, bytes, [&] {
+      SIMD::shift<double>(data.data(), count, 2.5);
+      doNotOptimize(data);
+    });
+
+    data = generateSamples(count);
+    runner.run(QStringLiteral("SIMD/findMin") + suffix, bytes, [&] {
+      doNotOptimize(SIMD::findMin<double>(data.data(), count));
+    });
+
+    runner.run(QStringLiteral("SIMD/findMax") + suffix, bytes, [&] {
+      doNotOptimize(SIMD::findMax<double>(data.data(), count));
+    });
+  }
+}
+
+/**
+ * @brief Benchmarks the checksum functions used to validate frames.
+ */
+static void benchChecksums(Runner &runner, const QList<qsizetype> &sizes)
+{
+  for (const auto size : sizes)
+  {
+    const auto data = generateBinary(size);
+    const auto length = static_cast<int>(size);
+    const auto suffix = QStringLiteral("/%1").arg(size);
+
+    runner.run(QStringLiteral("Checksum/crc8") + suffix, size, [&] {
+      doNotOptimize(IO::crc8(data.constData(), length));
+    });
+
+    runner.run(QStringLiteral("Checksum/crc16") + suffix, size, [&] {
+      doNotOptimize(IO::crc16(data.constData(), length));
+    });
+
+    runner.run(QStringLiteral("Checksum/crc32") + suffix, size, [&] {
+      doNotOptimize(IO::crc32(data.constData(), length));
+    });
+  }
+}
+
+/**
+ * @brief Benchmarks the conversion of received data into console text.
+ */
+static void benchConsole(Runner &runner, const QList<qsizetype> &sizes)
+{
+  for (const auto size : sizes)
+  {
+    const auto text = generateText(size);
+    const auto binary = generateBinary(size);
+    const auto suffix = QStringLiteral("/%1").arg(size);
+
+    runner.run(QStringLiteral("Console/plainTextStr") + suffix, size, [&] {
+      auto str = IO::Console::plainTextStr(text);
+      doNotOptimize(str);
+    });
+
+    runner.run(QStringLiteral("Console/hexadecimalStr") + suffix, size, [&] {
+      auto str = IO::Console::hexadecimalStr(binary);
+      doNotOptimize(str);
+    });
+  }
+}
+
+/**
+ * @brief Benchmarks the native field splitter against the default JavaScript
+ *        frame parser function, over a single comma-separated frame, and the
+ *        binary decoder over a frame of little-endian floats of equal size.
+ */
+static void benchFrameParsers(Runner &runner, const QList<qsizetype> &sizes)
+{
+  JSON::FrameScript script;
+  (void)script.load(QStringLiteral("function parse(frame) {\n"
+                                   "    return frame.split(',');\n"
+                                   "}\n"));
+
+  JSON::FieldSplitter splitter;
+  QVector<JSON::FieldSplitter::Field> fields;
+  for (const auto size : sizes)
+  {
+    auto frame = generateText(size);
+    frame.replace('\n', ',');
+    const auto suffix = QStringLiteral("/%1").arg(size);
+
+    const auto native = QStringLiteral("FrameParser/nativeSeparator");
+    runner.run(native + suffix, size, [&] {
+      splitter.split(frame, fields);
+      doNotOptimize(fields);
+    });
+
+    runner.run(QStringLiteral("FrameParser/javaScript") + suffix, size, [&] {
+      auto values = script.parse(QString::fromUtf8(frame));
+      doNotOptimize(values);
+    });
+
+    JSON::BinaryDecoder decoder;
+    for (qsizetype offset = 0; offset + 4 <= size; offset += 4)
+    {
+      JSON::BinaryField field;
+      field.type = JSON::BinaryField::Float32;
+      field.byteOffset = static_cast<int>(offset);
+      field.bigEndian = false;
+      decoder.addField(field);
+    }
+
+    QVector<double> values;
+    const auto binary = generateBinary(size);
+    runner.run(QStringLiteral("FrameParser/binaryStruct") + suffix, size, [&] {
+      decoder.decode(binary, values);
+      doNotOptimize(values);
+    });
+  }
+}
+
+/**
+ * @brief Benchmarks the calculation of plot axis intervals, swept across the
+ *        magnitude of the plotted range instead of an input size.
+ */
+static void benchSmartInterval(Runner &runner)
+{
+  for (int exponent = -3; exponent <= 9; exponent += 3)
+  {
+    const auto range = std::pow(10.0, exponent);
+    const auto name = QStringLiteral("Dashboard/smartInterval/1e%1");
+    runner.run(name.arg(exponent), 0, [&] {
+      doNotOptimize(UI::Dashboard::smartInterval(-range / 3, range));
+    });
+  }
+}
+
+//------------------------------------------------------------------------------
+// Entry point
+//------------------------------------------------------------------------------
+
+int main(int argc, char **argv)
+{
+  QCoreApplication::setApplicationName(QStringLiteral("bench_kernels"));
+  QCoreApplication app(argc, argv);
+
+  // clang-format off
+  QCommandLineParser parser;
+  parser.setApplicationDescription(QStringLiteral("Measures the performance of the core kernels."));
+  parser.addHelpOption();
+  parser.addOptions({
+    {QStringLiteral("filter"), QStringLiteral("Only run the benchmarks whose name matches the given regular expression."), QStringLiteral("regex"), QStringLiteral(".*")},
+    {QStringLiteral("sizes"), QStringLiteral("Comma-separated input sizes (default: 64,512,4096,32768,262144)."), QStringLiteral("list"), QStringLiteral("64,512,4096,32768,262144")},
+    {QStringLiteral("min-time"), QStringLiteral("Minimum time of each benchmark in seconds (default: 0.2)."), QStringLiteral("seconds"), QStringLiteral("0.2")},
+    {QStringLiteral("json"), QStringLiteral("Write the results to the given JSON file."), QStringLiteral("file")},
+  });
+  parser.process(app);
+  // clang-format on
+
+  // Read input sizes
+  QList<qsizetype> sizes;
+  const auto list = parser.value(QStringLiteral("sizes")).split(',');
+  for (const auto &item : list)
+  {
+    bool ok = false;
+    const auto size = item.trimmed().toLongLong(&ok);
+    if (!ok || size < 16)
+    {
+      qCritical() << "Invalid input size" << item << "(minimum is 16)";
+      return EXIT_FAILURE;
+    }
+
+    sizes.append(size);
+  }
+
+  // Read filter
+  const QRegularExpression filter(parser.value(QStringLiteral("filter")));
+  if (!filter.isValid())
+  {
+    qCritical() << "Invalid filter:" << filter.errorString();
+    return EXIT_FAILURE;
+  }
+
+  // Run benchmarks
+  const auto minTime = parser.value(QStringLiteral("min-time")).toDouble();
+  Runner runner(filter, qMax(0.001, minTime));
+  benchCircularBuffer(runner, sizes);
+  benchSIMD(runner, sizes);
+  benchChecksums(runner, sizes);
+  benchConsole(runner, sizes);
+  benchFrameParsers(runner, sizes);
+  benchSmartInterval(runner);
+
+  // Export results
+  if (parser.isSet(QStringLiteral("json")))
+  {
+    const auto path = parser.value(QStringLiteral("json"));
+    if (!runner.writeJson(path))
+    {
+      qCritical() << "Cannot write" << path;
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,717 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/**
+ * @file bench_pipeline.cpp
+ * @brief End-to-end throughput & latency benchmark of the data pipeline.
+ *
+ * Synthetic frames are written to a raw byte capture (see `IO::Capture`) and
+ * replayed as fast as possible with the `IO::Drivers::Replay` driver, so that
+ * data goes through the same threads, queues and flow control as data read
+ * from a real device:
+ *
+ *   Replay -> IO::FrameReader -> JSON::FrameBuilder -> UI::Dashboard
+ *
+ * The latency of each frame is measured at the end of every stage from the
+ * ingress timestamp assigned by the frame reader. Heap allocations are counted
+ * by wrapping `malloc()`, `calloc()` & `realloc()` on glibc, so that the
+ * storage of `QByteArray`, `QString` & `QList` is counted together with the
+ * objects created with `operator new`. On other C libraries, only the calls
+ * to the global `operator new` are counted, which excludes the storage of
+ * Qt containers.
+ */
+
+#include <QFile>
+#include <QTimer>
+#include <QJsonArray>
+#include <QJsonObject>
+#include <QTextStream>
+#include <QJsonDocument>
+#include <QTemporaryDir>
+#include <QCoreApplication>
+#include <QCommandLineParser>
+
+#include <atomic>
+#include <cmath>
+#include <deque>
+#include <cstdlib>
+#include <new>
+#include <vector>
+#include <algorithm>
+
+#include "AppInfo.h"
+#include "IO/Capture.h"
+#include "IO/Checksum.h"
+#include "IO/FrameBatch.h"
+#include "IO/Manager.h"
+#include "IO/Drivers/Replay.h"
+#include "JSON/FrameBuilder.h"
+#include "JSON/ProjectModel.h"
+#include "UI/Dashboard.h"
+
+//------------------------------------------------------------------------------
+// Allocation counter
+//------------------------------------------------------------------------------
+
+static std::atomic<quint64> ALLOCATIONS(0);
+
+#ifdef __GLIBC__
+static constexpr bool COUNTS_MALLOC = true;
+
+extern "C" {
+void *__libc_malloc(std::size_t size);
+void *__libc_calloc(std::size_t count, std::size_t size);
+void *__libc_realloc(void *ptr, std::size_t size);
+
+void *malloc(std::size_t size) noexcept
+{
+  ALLOCATIONS.fetch_add(1, std::memory_order_relaxed);
+  return __libc_malloc(size);
+}
+
+void *calloc(std::size_t count, std::size_t size) noexcept
+{
+  ALLOCATIONS.fetch_add(1, std::memory_order_relaxed);
+  return __libc_calloc(count, size);
+}
+
+void *realloc(void *ptr, std::size_t size) noexcept
+{
+  ALLOCATIONS.fetch_add(1, std::memory_order_relaxed);
+  return __libc_realloc(ptr, size);
+}
+}
+#else
+static constexpr bool COUNTS_MALLOC = false;
+#endif
+
+void *operator new(std::size_t size)
+{
+  // With glibc, the allocation is counted by malloc()
+  if (!COUNTS_MALLOC)
+    ALLOCATIONS.fetch_add(1, std::memory_order_relaxed);
+
+  if (void *ptr = std::malloc(size > 0 ? size : 1))
+    return ptr;
+
+  throw std::bad_alloc();
+}
+
+void operator delete(void *ptr) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept
+{
+  std::free(ptr);
+}
+
+//------------------------------------------------------------------------------
+// Benchmark parameters
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Parameters of a benchmark run, obtained from the command line.
+ */
+struct Options
+{
+  SerialStudio::OperationMode mode = SerialStudio::ProjectFile;
+  bool startAndEnd = false;  /**< Use start & end delimiters in project mode. */
+  bool nativeParser = false; /**< Split frames natively instead of with JS. */
+  bool checksum = false;     /**< Append a CRC-16 trailer to every frame. */
+  bool json = false;         /**< Print the results as a JSON document. */
+  int frames = 100000;       /**< Number of frames to send. */
+  int frameSize = 64;        /**< Bytes used by the values of each frame. */
+  int datasets = 8;          /**< Number of values in each frame. */
+  int chunkSize = 4096;      /**< Bytes delivered by each driver read. */
+};
+
+/**
+ * @brief Latencies of the frames that went through a pipeline stage.
+ */
+struct Stage
+{
+  QString name;
+  std::vector<qint64> latencies;
+
+  /**
+   * @brief Returns the given @a percentile (0-1) of the latencies in
+   *        microseconds.
+   */
+  double percentile(const double percentile) const
+  {
+    if (latencies.empty())
+      return 0;
+
+    auto sorted = latencies;
+    const auto index = static_cast<size_t>(
+        std::llround(percentile * static_cast<double>(sorted.size() - 1)));
+    std::nth_element(sorted.begin(), sorted.begin() + index, sorted.end());
+    return static_cast<double>(sorted[index]) / 1000.0;
+  }
+};
+
+/**
+ * @brief A frame that left a pipeline stage and waits for the next one.
+ */
+struct PendingFrame
+{
+  qint64 ingress; /**< Ingress timestamp assigned by the frame reader. */
+  qint64 time;    /**< Time at which the frame left the previous stage. */
+};
+
+//------------------------------------------------------------------------------
+// Synthetic data generation
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Generates the comma-separated values of the @a n-th frame.
+ *
+ * Values are zero-padded so that the values of every frame take roughly
+ * `Options::frameSize` bytes.
+ */
+static QByteArray generateValues(const Options &opts, const int n)
+{
+  const int separators = opts.datasets - 1;
+  const int width = qMax(4, (opts.frameSize - separators) / opts.datasets);
+
+  QByteArray values;
+  values.reserve(opts.frameSize + opts.datasets);
+  for (int i = 0; i < opts.datasets; ++i)
+  {
+    if (i > 0)
+      values.append(',');
+
+    const double value = 500 + 499 * std::sin(0.01 * n + i);
+    values.append(QByteArray::number(value, 'f', 2).rightJustified(width, '0'));
+  }
+
+  return values;
+}
+
+/**
+ * @brief Generates the JSON frame of the @a n-th frame in JSON mode.
+ */
+static QByteArray generateJsonFrame(const Options &opts, const int n)
+{
+  const auto values = generateValues(opts, n).split(',');
+
+  QJsonArray datasets;
+  for (int i = 0; i < values.count(); ++i)
+  {
+    QJsonObject dataset;
+    dataset.insert(QStringLiteral("title"), QStringLiteral("Value %1").arg(i));
+    dataset.insert(QStringLiteral("value"), QString::fromUtf8(values[i]));
+    dataset.insert(QStringLiteral("index"), i + 1);
+    dataset.insert(QStringLiteral("graph"), true);
+    datasets.append(dataset);
+  }
+
+  QJsonObject group;
+  group.insert(QStringLiteral("title"), QStringLiteral("Values"));
+  group.insert(QStringLiteral("widget"), QStringLiteral("datagrid"));
+  group.insert(QStringLiteral("datasets"), datasets);
+
+  QJsonObject frame;
+  frame.insert(QStringLiteral("title"), QStringLiteral("Pipeline Benchmark"));
+  frame.insert(QStringLiteral("groups"), QJsonArray{group});
+  return QJsonDocument(frame).toJson(QJsonDocument::Compact);
+}
+
+/**
+ * @brief Generates the bytes sent by the device for the @a n-th frame,
+ *        including delimiters & checksum trailer.
+ */
+static QByteArray generateFrame(const Options &opts, const int n)
+{
+  // Obtain the frame payload & delimiters
+  QByteArray start;
+  QByteArray finish;
+  QByteArray payload;
+  if (opts.mode == SerialStudio::DeviceSendsJSON)
+  {
+    start = QByteArrayLiteral("/*");
+    finish = QByteArrayLiteral("*/");
+    payload = generateJsonFrame(opts, n);
+  }
+
+  else
+  {
+    finish = QByteArrayLiteral("\n");
+    payload = generateValues(opts, n);
+    if (opts.mode == SerialStudio::ProjectFile && opts.startAndEnd)
+    {
+      start = QByteArrayLiteral("$");
+      finish = QByteArrayLiteral(";");
+    }
+  }
+
+  // Build the frame
+  QByteArray frame = start + payload + finish;
+  if (opts.checksum)
+  {
+    const auto crc = IO::crc16(payload.constData(), payload.size());
+    frame.append(QByteArrayLiteral("crc16:"));
+    frame.append(static_cast<char>((crc >> 8) & 0xFF));
+    frame.append(static_cast<char>(crc & 0xFF));
+  }
+
+  return frame;
+}
+
+/**
+ * @brief Generates a project file that parses the synthetic frames with a
+ *        JavaScript frame parser, or with the native field splitter.
+ */
+static QJsonObject generateProject(const Options &opts)
+{
+  QJsonArray datasets;
+  for (int i = 0; i < opts.datasets; ++i)
+  {
+    QJsonObject dataset;
+    dataset.insert(QStringLiteral("title"), QStringLiteral("Value %1").arg(i));
+    dataset.insert(QStringLiteral("index"), i + 1);
+    dataset.insert(QStringLiteral("graph"), true);
+    dataset.insert(QStringLiteral("min"), 0);
+    dataset.insert(QStringLiteral("max"), 1000);
+    dataset.insert(QStringLiteral("widget"), QString());
+    datasets.append(dataset);
+  }
+
+  QJsonObject group;
+  group.insert(QStringLiteral("title"), QStringLiteral("Values"));
+  group.insert(QStringLiteral("widget"), QStringLiteral("datagrid"));
+  group.insert(QStringLiteral("datasets"), datasets);
+
+  const auto detection = opts.startAndEnd ? SerialStudio::StartAndEndDelimiter
+                                          : SerialStudio::EndDelimiterOnly;
+  const auto checksum = opts.checksum ? SerialStudio::CRC16
+                                      : SerialStudio::NoChecksum;
+  const auto frameEnd = opts.startAndEnd ? QStringLiteral(";")
+                                         : QStringLiteral("\\n");
+
+  QJsonObject project;
+  project.insert(QStringLiteral("title"), QStringLiteral("Pipeline Benchmark"));
+  project.insert(QStringLiteral("decoder"), SerialStudio::PlainText);
+  project.insert(QStringLiteral("frameDetection"), detection);
+  project.insert(QStringLiteral("checksum"), checksum);
+  project.insert(QStringLiteral("frameStart"), QStringLiteral("$"));
+  project.insert(QStringLiteral("frameEnd"), frameEnd);
+  project.insert(QStringLiteral("parserMethod"),
+                 opts.nativeParser ? SerialStudio::NativeSeparator
+                                   : SerialStudio::ScriptParser);
+  project.insert(QStringLiteral("fieldSeparator"), QStringLiteral(","));
+  project.insert(QStringLiteral("frameParser"),
+                 QStringLiteral("function parse(frame) {\n"
+                                "    return frame.split(',');\n"
+                                "}\n"));
+  project.insert(QStringLiteral("groups"), QJsonArray{group});
+  project.insert(QStringLiteral("actions"), QJsonArray());
+  return project;
+}
+
+/**
+ * @brief Writes the synthetic frames to a capture file, in records of
+ *        `Options::chunkSize` bytes.
+ *
+ * @return Number of bytes written, or -1 on error.
+ */
+static qint64 writeCapture(const QString &path, const Options &opts)
+{
+  IO::Capture::Writer writer;
+  if (!writer.open(path))
+  {
+    qCritical() << "Cannot create capture:" << writer.errorString();
+    return -1;
+  }
+
+  qint64 bytes = 0;
+  qint64 timestamp = 0;
+  QByteArray chunk;
+  for (int n = 0; n < opts.frames; ++n)
+  {
+    chunk.append(generateFrame(opts, n));
+    if (chunk.size() >= opts.chunkSize || n == opts.frames - 1)
+    {
+      if (!writer.append(timestamp, chunk.constData(), chunk.size()))
+      {
+        qCritical() << "Cannot write capture:" << writer.errorString();
+        return -1;
+      }
+
+      bytes += chunk.size();
+      timestamp += 1000;
+      chunk.clear();
+    }
+  }
+
+  writer.close();
+  return bytes;
+}
+
+//------------------------------------------------------------------------------
+// Results
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Returns a human-readable description of the benchmark parameters.
+ */
+static QString describe(const Options &opts)
+{
+  QString mode;
+  if (opts.mode == SerialStudio::QuickPlot)
+    mode = QStringLiteral("quick plot");
+  else if (opts.mode == SerialStudio::DeviceSendsJSON)
+    mode = QStringLiteral("JSON");
+  else if (opts.startAndEnd)
+    mode = QStringLiteral("project (%1), start & end delimiters");
+  else
+    mode = QStringLiteral("project (%1), end delimiter");
+
+  if (opts.mode == SerialStudio::ProjectFile)
+    mode = mode.arg(opts.nativeParser ? QStringLiteral("native parser")
+                                      : QStringLiteral("JS parser"));
+
+  if (opts.checksum)
+    mode += QStringLiteral(", CRC-16");
+
+  return mode;
+}
+
+/**
+ * @brief Prints the results of the benchmark in a table or as JSON.
+ */
+static void report(const Options &opts, const std::vector<Stage> &stages,
+                   const qint64 frames, const qint64 bytes,
+                   const qint64 elapsed, const quint64 allocations)
+{
+  const double seconds = static_cast<double>(qMax<qint64>(elapsed, 1)) / 1e9;
+  const double fps = static_cast<double>(frames) / seconds;
+  const double bps = static_cast<double>(bytes) / seconds;
+  const double apf = frames > 0 ? static_cast<double>(allocations) / frames : 0;
+
+  QTextStream out(stdout);
+
+  // Print machine-readable results
+  if (opts.json)
+  {
+    QJsonArray array;
+    for (const auto &stage : stages)
+    {
+      QJsonObject object;
+      object.insert(QStringLiteral("name"), stage.name);
+      object.insert(QStringLiteral("p50_us"), stage.percentile(0.50));
+      object.insert(QStringLiteral("p99_us"), stage.percentile(0.99));
+      array.append(object);
+    }
+
+    QJsonObject results;
+    results.insert(QStringLiteral("mode"), describe(opts));
+    results.insert(QStringLiteral("frames"), frames);
+    results.insert(QStringLiteral("frames_sent"), opts.frames);
+    results.insert(QStringLiteral("frame_size"), opts.frameSize);
+    results.insert(QStringLiteral("datasets"), opts.datasets);
+    results.insert(QStringLiteral("bytes"), bytes);
+    results.insert(QStringLiteral("seconds"), seconds);
+    results.insert(QStringLiteral("frames_per_second"), fps);
+    results.insert(QStringLiteral("bytes_per_second"), bps);
+    results.insert(QStringLiteral("allocations_per_frame"), apf);
+    results.insert(QStringLiteral("allocation_counter"),
+                   COUNTS_MALLOC ? QStringLiteral("malloc")
+                                 : QStringLiteral("operator new"));
+    results.insert(QStringLiteral("stages"), array);
+    out << QJsonDocument(results).toJson(QJsonDocument::Indented);
+    return;
+  }
+
+  // Print table
+  out << "Mode:        " << describe(opts) << "\n";
+  out << "Frames:      " << frames << " of " << opts.frames << ", "
+      << opts.datasets << " datasets, " << opts.frameSize << " value bytes\n";
+  out << "Duration:    " << QString::number(seconds, 'f', 3) << " s\n";
+  out << "Throughput:  " << QString::number(fps, 'f', 0) << " frames/s, "
+      << QString::number(bps / (1024 * 1024), 'f', 2) << " MiB/s\n";
+  out << "Allocations: " << QString::number(apf, 'f', 1) << " per frame"
+      << (COUNTS_MALLOC ? "\n\n" : " (operator new calls only)\n\n");
+  out << QStringLiteral("%1%2%3\n")
+             .arg(QStringLiteral("Stage"), -16)
+             .arg(QStringLiteral("p50 (us)"), 12)
+             .arg(QStringLiteral("p99 (us)"), 12);
+  for (const auto &stage : stages)
+  {
+    out << QStringLiteral("%1%2%3\n")
+               .arg(stage.name, -16)
+               .arg(stage.percentile(0.50), 12, 'f', 1)
+               .arg(stage.percentile(0.99), 12, 'f', 1);
+  }
+}
+
+//------------------------------------------------------------------------------
+// Entry point
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Reads the benchmark parameters from the command line.
+ *
+ * @return @c false if a parameter is invalid.
+ */
+static bool readOptions(const QCoreApplication &app, Options &opts)
+{
+  // clang-format off
+  QCommandLineParser parser;
+  parser.setApplicationDescription(QStringLiteral("Measures the throughput & latency of the data pipeline."));
+  parser.addHelpOption();
+  parser.addOptions({
+    {QStringLiteral("mode"), QStringLiteral("Operation mode: quickplot, project or json (default: project)."), QStringLiteral("mode"), QStringLiteral("project")},
+    {QStringLiteral("delimiter"), QStringLiteral("Frame delimiters in project mode: end or start-end (default: end)."), QStringLiteral("type"), QStringLiteral("end")},
+    {QStringLiteral("parser"), QStringLiteral("Frame parser in project mode: js or native (default: js)."), QStringLiteral("type"), QStringLiteral("js")},
+    {QStringLiteral("crc"), QStringLiteral("Append a CRC-16 trailer to every frame.")},
+    {QStringLiteral("frames"), QStringLiteral("Number of frames (default: 100000)."), QStringLiteral("count"), QStringLiteral("100000")},
+    {QStringLiteral("frame-size"), QStringLiteral("Bytes used by the values of each frame (default: 64)."), QStringLiteral("bytes"), QStringLiteral("64")},
+    {QStringLiteral("datasets"), QStringLiteral("Number of values in each frame (default: 8)."), QStringLiteral("count"), QStringLiteral("8")},
+    {QStringLiteral("chunk-size"), QStringLiteral("Bytes delivered by each driver read (default: 4096)."), QStringLiteral("bytes"), QStringLiteral("4096")},
+    {QStringLiteral("json"), QStringLiteral("Print the results as JSON.")},
+  });
+  parser.process(app);
+  // clang-format on
+
+  // Read operation mode
+  const auto mode = parser.value(QStringLiteral("mode"));
+  if (mode == QStringLiteral("quickplot"))
+    opts.mode = SerialStudio::QuickPlot;
+  else if (mode == QStringLiteral("project"))
+    opts.mode = SerialStudio::ProjectFile;
+  else if (mode == QStringLiteral("json"))
+    opts.mode = SerialStudio::DeviceSendsJSON;
+  else
+  {
+    qCritical() << "Invalid operation mode" << mode;
+    return false;
+  }
+
+  // Read frame delimiters
+  const auto delimiter = parser.value(QStringLiteral("delimiter"));
+  if (delimiter != QStringLiteral("end")
+      && delimiter != QStringLiteral("start-end"))
+  {
+    qCritical() << "Invalid delimiter type" << delimiter;
+    return false;
+  }
+
+  // Read frame parser
+  const auto frameParser = parser.value(QStringLiteral("parser"));
+  if (frameParser != QStringLiteral("js")
+      && frameParser != QStringLiteral("native"))
+  {
+    qCritical() << "Invalid frame parser" << frameParser;
+    return false;
+  }
+
+  // Read the rest of the parameters
+  opts.nativeParser = frameParser == QStringLiteral("native");
+  opts.checksum = parser.isSet(QStringLiteral("crc"));
+  opts.json = parser.isSet(QStringLiteral("json"));
+  opts.startAndEnd = delimiter == QStringLiteral("start-end");
+  opts.frames = parser.value(QStringLiteral("frames")).toInt();
+  opts.frameSize = parser.value(QStringLiteral("frame-size")).toInt();
+  opts.datasets = parser.value(QStringLiteral("datasets")).toInt();
+  opts.chunkSize = parser.value(QStringLiteral("chunk-size")).toInt();
+  if (opts.frames <= 0 || opts.frameSize <= 0 || opts.datasets <= 0
+      || opts.chunkSize <= 0)
+  {
+    qCritical() << "Frame count, frame size, dataset count and chunk size"
+                << "must be positive numbers";
+    return false;
+  }
+
+  return true;
+}
+
+int main(int argc, char **argv)
+{
+  // Use separate settings, so that the benchmark does not alter the
+  // configuration of the application
+  QCoreApplication::setApplicationName(QStringLiteral("bench_pipeline"));
+  QCoreApplication::setOrganizationName(APP_DEVELOPER);
+  QCoreApplication app(argc, argv);
+
+  // Read parameters
+  Options opts;
+  if (!readOptions(app, opts))
+    return EXIT_FAILURE;
+
+  // Generate the capture & the project file
+  QTemporaryDir dir;
+  const auto capturePath = dir.filePath(QStringLiteral("frames.sscap"));
+  const auto projectPath = dir.filePath(QStringLiteral("project.json"));
+  const auto bytes = writeCapture(capturePath, opts);
+  if (bytes < 0)
+    return EXIT_FAILURE;
+
+  QFile project(projectPath);
+  if (!project.open(QFile::WriteOnly))
+    return EXIT_FAILURE;
+
+  project.write(QJsonDocument(generateProject(opts)).toJson());
+  project.close();
+
+  // Initialize the modules of the pipeline
+  auto &manager = IO::Manager::instance();
+  auto &projectModel = JSON::ProjectModel::instance();
+  auto &frameBuilder = JSON::FrameBuilder::instance();
+  (void)UI::Dashboard::instance();
+  manager.setupExternalConnections();
+  projectModel.setupExternalConnections();
+  frameBuilder.setupExternalConnections();
+
+  // Configure the operation mode
+  frameBuilder.setOperationMode(opts.mode);
+  if (opts.mode == SerialStudio::ProjectFile)
+  {
+    frameBuilder.loadJsonMap(projectPath);
+    if (frameBuilder.jsonMapFilepath().isEmpty())
+      return EXIT_FAILURE;
+  }
+
+  // Replay the capture as fast as the pipeline allows
+  auto &replay = IO::Drivers::Replay::instance();
+  replay.setFilePath(capturePath);
+  replay.setAsFastAsPossible(true);
+  manager.setBusType(SerialStudio::BusType::Replay);
+
+  // Initialize stage statistics
+  std::vector<Stage> stages(4);
+  stages[0].name = QStringLiteral("FrameReader");
+  stages[1].name = QStringLiteral("FrameBuilder");
+  stages[2].name = QStringLiteral("Dashboard");
+  stages[3].name = QStringLiteral("End-to-end");
+  for (auto &stage : stages)
+    stage.latencies.reserve(opts.frames);
+
+  qint64 delivered = 0;
+  qint64 lastDelivery = 0;
+  std::deque<PendingFrame> built;
+  std::deque<PendingFrame> extracted;
+
+  // Frames extracted by the frame reader reach the main thread
+  QObject::connect(
+      &manager, &IO::Manager::framesReceived, &app,
+      [&](const IO::FrameBatch &batch) {
+        const auto now = IO::monotonicTimestamp();
+        for (const auto ingress : batch.timestamps)
+        {
+          stages[0].latencies.push_back(now - ingress);
+          extracted.push_back({ingress, now});
+        }
+      },
+      Qt::DirectConnection);
+
+  // Frames built by the frame builder, raw frames that were not parsed are
+  // skipped by comparing ingress timestamps
+  QObject::connect(
+      &frameBuilder, &JSON::FrameBuilder::framesChanged, &app,
+      [&](const JSON::FrameBatch &batch) {
+        const auto now = IO::monotonicTimestamp();
+        for (const auto ingress : batch.timestamps)
+        {
+          while (!extracted.empty() && extracted.front().ingress < ingress)
+            extracted.pop_front();
+
+          if (!extracted.empty())
+          {
+            stages[1].latencies.push_back(now - extracted.front().time);
+            extracted.pop_front();
+          }
+
+          built.push_back({ingress, now});
+        }
+      },
+      Qt::DirectConnection);
+
+  // Frames processed by the dashboard, this queued connection is made after
+  // the one of the dashboard, so it runs right after the dashboard handled
+  // the same batch
+  QObject::connect(
+      &frameBuilder, &JSON::FrameBuilder::framesChanged, &app,
+      [&](const JSON::FrameBatch &batch) {
+        const auto now = IO::monotonicTimestamp();
+        for (const auto ingress : batch.timestamps)
+        {
+          if (!built.empty())
+          {
+            stages[2].latencies.push_back(now - built.front().time);
+            built.pop_front();
+          }
+
+          stages[3].latencies.push_back(now - ingress);
+        }
+
+        delivered += batch.timestamps.size();
+        lastDelivery = now;
+      },
+      Qt::QueuedConnection);
+
+  // Stop when all frames were processed, or when the pipeline is idle after
+  // the end of the capture
+  qint64 idleSince = 0;
+  qint64 lastCount = -1;
+  QTimer monitor;
+  monitor.setInterval(100);
+  QObject::connect(&monitor, &QTimer::timeout, &app, [&] {
+    if (delivered >= opts.frames)
+    {
+      app.quit();
+      return;
+    }
+
+    const auto now = IO::monotonicTimestamp();
+    if (delivered != lastCount)
+    {
+      idleSince = now;
+      lastCount = delivered;
+    }
+
+    else if (replay.finished() && now - idleSince > 2000000000)
+      app.quit();
+  });
+
+  // Run the benchmark
+  const auto allocations = ALLOCATIONS.load(std::memory_order_relaxed);
+  const auto start = IO::monotonicTimestamp();
+  manager.connectDevice();
+  if (!manager.isConnected())
+  {
+    qCritical() << "Cannot replay the capture";
+    return EXIT_FAILURE;
+  }
+
+  monitor.start();
+  app.exec();
+  manager.disconnectDevice();
+
+  // Print results
+  const auto allocated = ALLOCATIONS.load(std::memory_order_relaxed);
+  report(opts, stages, delivered, bytes, lastDelivery - start,
+         allocated - allocations);
+
+  return delivered > 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
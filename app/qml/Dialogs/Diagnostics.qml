@@ -0,0 +1,337 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+
+import QtCore
+import QtQuick
+import QtQuick.Window
+import QtQuick.Layouts
+import QtQuick.Controls
+
+Window {
+  id: root
+
+  //
+  // Window options
+  //
+  width: minimumWidth
+  height: minimumHeight
+  title: qsTr("Diagnostics")
+  minimumWidth: column.implicitWidth + 32
+  maximumWidth: column.implicitWidth + 32
+  minimumHeight: column.implicitHeight + 32
+  maximumHeight: column.implicitHeight + 32
+
+  //
+  // Layout constants
+  //
+  readonly property int nameWidth: 96
+  readonly property int valueWidth: 72
+  readonly property int barWidth: 36
+  readonly property int barHeight: 40
+
+  //
+  // Make window stay on top
+  //
+  Component.onCompleted: {
+    root.flags = Qt.Dialog |
+        Qt.WindowTitleHint |
+        Qt.WindowCloseButtonHint
+  }
+
+  //
+  // Close shortcut
+  //
+  Shortcut {
+    sequences: [StandardKey.Close]
+    onActivated: root.close()
+  }
+
+  //
+  // Use page item to set application palette
+  //
+  Page {
+    anchors.fill: parent
+    anchors.topMargin: root.titlebarHeight
+    palette.mid: Cpp_ThemeManager.colors["mid"]
+    palette.dark: Cpp_ThemeManager.colors["dark"]
+    palette.text: Cpp_ThemeManager.colors["text"]
+    palette.base: Cpp_ThemeManager.colors["base"]
+    palette.link: Cpp_ThemeManager.colors["link"]
+    palette.light: Cpp_ThemeManager.colors["light"]
+    palette.window: Cpp_ThemeManager.colors["window"]
+    palette.shadow: Cpp_ThemeManager.colors["shadow"]
+    palette.accent: Cpp_ThemeManager.colors["accent"]
+    palette.button: Cpp_ThemeManager.colors["button"]
+    palette.midlight: Cpp_ThemeManager.colors["midlight"]
+    palette.highlight: Cpp_ThemeManager.colors["highlight"]
+    palette.windowText: Cpp_ThemeManager.colors["window_text"]
+    palette.brightText: Cpp_ThemeManager.colors["bright_text"]
+    palette.buttonText: Cpp_ThemeManager.colors["button_text"]
+    palette.toolTipBase: Cpp_ThemeManager.colors["tooltip_base"]
+    palette.toolTipText: Cpp_ThemeManager.colors["tooltip_text"]
+    palette.linkVisited: Cpp_ThemeManager.colors["link_visited"]
+    palette.alternateBase: Cpp_ThemeManager.colors["alternate_base"]
+    palette.placeholderText: Cpp_ThemeManager.colors["placeholder_text"]
+    palette.highlightedText: Cpp_ThemeManager.colors["highlighted_text"]
+
+    //
+    // Window controls
+    //
+    ColumnLayout {
+      id: column
+      spacing: 8
+      anchors.centerIn: parent
+
+      //
+      // Latency statistics
+      //
+      Label {
+        font: Cpp_Misc_CommonFonts.boldUiFont
+        text: qsTr("Latency Since Data Reception (Last 10 Seconds)")
+      } GroupBox {
+        Layout.fillWidth: true
+
+        background: Rectangle {
+          radius: 2
+          border.width: 1
+          color: Cpp_ThemeManager.colors["groupbox_background"]
+          border.color: Cpp_ThemeManager.colors["groupbox_border"]
+        }
+
+        ColumnLayout {
+          spacing: 4
+          anchors.fill: parent
+
+          //
+          // Table header
+          //
+          RowLayout {
+            spacing: 0
+
+            Repeater {
+              model: [qsTr("Stage"), qsTr("Frames"), qsTr("Mean"),
+                qsTr("Median"), qsTr("P90"), qsTr("P99"), qsTr("Max")]
+              delegate: Label {
+                text: modelData
+                font: Cpp_Misc_CommonFonts.boldUiFont
+                Layout.preferredWidth: index === 0 ? root.nameWidth :
+                                                     root.valueWidth
+                horizontalAlignment: index === 0 ? Text.AlignLeft :
+                                                   Text.AlignRight
+              }
+            }
+          }
+
+          //
+          // Statistics of each stage
+          //
+          Repeater {
+            model: Cpp_Misc_LatencyMonitor.stages
+            delegate: RowLayout {
+              spacing: 0
+
+              readonly property var stage: modelData
+
+              Label {
+                text: stage["name"]
+                Layout.preferredWidth: root.nameWidth
+              }
+
+              Repeater {
+                model: [stage["count"].toString(),
+                  qsTr("%1 ms").arg(stage["mean"].toFixed(2)),
+                  qsTr("%1 ms").arg(stage["p50"].toFixed(2)),
+                  qsTr("%1 ms").arg(stage["p90"].toFixed(2)),
+                  qsTr("%1 ms").arg(stage["p99"].toFixed(2)),
+                  qsTr("%1 ms").arg(stage["max"].toFixed(2))]
+                delegate: Label {
+                  text: modelData
+                  font: Cpp_Misc_CommonFonts.monoFont
+                  Layout.preferredWidth: root.valueWidth
+                  horizontalAlignment: Text.AlignRight
+                }
+              }
+            }
+          }
+        }
+      }
+
+      //
+      // Latency histograms
+      //
+      Label {
+        font: Cpp_Misc_CommonFonts.boldUiFont
+        text: qsTr("Latency Histograms")
+      } GroupBox {
+        Layout.fillWidth: true
+
+        background: Rectangle {
+          radius: 2
+          border.width: 1
+          color: Cpp_ThemeManager.colors["groupbox_background"]
+          border.color: Cpp_ThemeManager.colors["groupbox_border"]
+        }
+
+        ColumnLayout {
+          spacing: 4
+          anchors.fill: parent
+
+          //
+          // Histogram of each stage
+          //
+          Repeater {
+            model: Cpp_Misc_LatencyMonitor.stages
+            delegate: RowLayout {
+              spacing: 0
+
+              readonly property var stage: modelData
+
+              Label {
+                text: stage["name"]
+                Layout.preferredWidth: root.nameWidth
+                Layout.alignment: Qt.AlignVCenter
+              }
+
+              Repeater {
+                model: stage["histogram"]
+                delegate: Item {
+                  implicitWidth: root.barWidth
+                  implicitHeight: root.barHeight
+
+                  Rectangle {
+                    anchors.bottom: parent.bottom
+                    anchors.left: parent.left
+                    anchors.right: parent.right
+                    anchors.leftMargin: 2
+                    anchors.rightMargin: 2
+                    color: Cpp_ThemeManager.colors["highlight"]
+                    height: modelData > 0 ? Math.max(1, modelData * root.barHeight) : 0
+                  }
+                }
+              }
+            }
+          }
+
+          //
+          // Bucket labels
+          //
+          RowLayout {
+            spacing: 0
+
+            Item {
+              Layout.preferredWidth: root.nameWidth
+            }
+
+            Repeater {
+              model: Cpp_Misc_LatencyMonitor.bucketLabels
+              delegate: Label {
+                text: modelData
+                opacity: 0.8
+                font: Cpp_Misc_CommonFonts.customUiFont(0.8, false)
+                Layout.preferredWidth: root.barWidth
+                horizontalAlignment: Text.AlignHCenter
+              }
+            }
+          }
+        }
+      }
+
+      //
+      // Thread scheduling
+      //
+      Label {
+        font: Cpp_Misc_CommonFonts.boldUiFont
+        text: qsTr("Threads")
+      } GroupBox {
+        Layout.fillWidth: true
+
+        background: Rectangle {
+          radius: 2
+          border.width: 1
+          color: Cpp_ThemeManager.colors["groupbox_background"]
+          border.color: Cpp_ThemeManager.colors["groupbox_border"]
+        }
+
+        GridLayout {
+          columns: 4
+          rowSpacing: 4
+          columnSpacing: 8
+          anchors.fill: parent
+
+          Label {
+            text: qsTr("Thread")
+            font: Cpp_Misc_CommonFonts.boldUiFont
+          } Label {
+            text: qsTr("Scheduling")
+            font: Cpp_Misc_CommonFonts.boldUiFont
+          } Label {
+            text: qsTr("CPUs")
+            font: Cpp_Misc_CommonFonts.boldUiFont
+          } Label {
+            text: qsTr("Status")
+            Layout.fillWidth: true
+            font: Cpp_Misc_CommonFonts.boldUiFont
+          }
+
+          //
+          // One row per thread, with one cell per column
+          //
+          Repeater {
+            model: Cpp_Misc_ThreadScheduler.threads.length * 4
+            delegate: Label {
+              readonly property int column: index % 4
+              readonly property var keys: ["name", "scheduling", "cpus", "status"]
+              readonly property var thread: Cpp_Misc_ThreadScheduler.threads[Math.floor(index / 4)]
+
+              text: thread ? thread[keys[column]] : ""
+              Layout.fillWidth: column === 3
+              Layout.maximumWidth: column === 3 ? 320 : -1
+              wrapMode: column === 3 ? Text.WordWrap : Text.NoWrap
+            }
+          }
+        }
+      }
+
+      //
+      // Reset button
+      //
+      RowLayout {
+        spacing: 4
+        Layout.fillWidth: true
+
+        Item {
+          Layout.fillWidth: true
+        }
+
+        Button {
+          text: qsTr("Reset")
+          onClicked: Cpp_Misc_LatencyMonitor.reset()
+        }
+
+        Button {
+          text: qsTr("Close")
+          onClicked: root.close()
+        }
+      }
+    }
+  }
+}
@@ -48,6 +48,9 @@ Window {
   Settings {
     category: "Preferences"
     property alias plugins: _tcpPlugins.checked
+    property alias batchLatency: _batchLatency.value
+    property alias queueCapacity: _queueCapacity.value
+    property alias backpressurePolicy: _backpressure.currentIndex
     property alias dashboardPoints: _points.value
     property alias language: _langCombo.currentIndex
     property alias dashboardPrecision: _decimalDigits.value
@@ -170,6 +173,60 @@ Window {
             }
           }
 
+          //
+          // Frame batch latency
+          //
+          Label {
+            text: qsTr("Frame Batch Latency (ms)") + ":"
+          } SpinBox {
+            id: _batchLatency
+
+            from: 0
+            to: 1000
+            editable: true
+            Layout.fillWidth: true
+            value: Cpp_IO_Manager.batchLatency
+            onValueChanged: {
+              if (value !== Cpp_IO_Manager.batchLatency)
+                Cpp_IO_Manager.batchLatency = value
+            }
+          }
+
+          //
+          // Frame queue capacity
+          //
+          Label {
+            text: qsTr("Frame Queue Capacity") + ":"
+          } SpinBox {
+            id: _queueCapacity
+
+            from: 16
+            to: 65536
+            editable: true
+            Layout.fillWidth: true
+            value: Cpp_IO_Manager.queueCapacity
+            onValueChanged: {
+              if (value !== Cpp_IO_Manager.queueCapacity)
+                Cpp_IO_Manager.queueCapacity = value
+            }
+          }
+
+          //
+          // Backpressure policy
+          //
+          Label {
+            text: qsTr("When Frame Queue Is Full") + ":"
+          } ComboBox {
+            id: _backpressure
+            Layout.fillWidth: true
+            model: Cpp_IO_Manager.backpressurePolicies
+            currentIndex: Cpp_IO_Manager.backpressurePolicy
+            onCurrentIndexChanged: {
+              if (currentIndex !== Cpp_IO_Manager.backpressurePolicy)
+                Cpp_IO_Manager.backpressurePolicy = currentIndex
+            }
+          }
+
           //
           // Auto-updater
           //
@@ -296,6 +353,106 @@ Window {
         implicitHeight: 4
       }
 
+      //
+      // Thread scheduling settings
+      //
+      Label {
+        text: qsTr("Threads")
+        visible: Cpp_Misc_ThreadScheduler.supported
+        font: Cpp_Misc_CommonFonts.customUiFont(0.8, true)
+        color: Cpp_ThemeManager.colors["pane_section_label"]
+        Component.onCompleted: font.capitalization = Font.AllUppercase
+      } GroupBox {
+        Layout.fillWidth: true
+        visible: Cpp_Misc_ThreadScheduler.supported
+
+        background: Rectangle {
+          radius: 2
+          border.width: 1
+          color: Cpp_ThemeManager.colors["groupbox_background"]
+          border.color: Cpp_ThemeManager.colors["groupbox_border"]
+        }
+
+        GridLayout {
+          columns: 2
+          rowSpacing: 4
+          columnSpacing: 8
+          anchors.fill: parent
+
+          //
+          // Scheduling policy of the device I/O & frame reader threads
+          //
+          Label {
+            text: qsTr("Data Thread Scheduling") + ":"
+          } ComboBox {
+            Layout.fillWidth: true
+            model: Cpp_Misc_ThreadScheduler.policies
+            currentIndex: Cpp_Misc_ThreadScheduler.policy
+            onCurrentIndexChanged: {
+              if (currentIndex !== Cpp_Misc_ThreadScheduler.policy)
+                Cpp_Misc_ThreadScheduler.policy = currentIndex
+            }
+          }
+
+          //
+          // Real-time priority
+          //
+          Label {
+            text: qsTr("Real-Time Priority") + ":"
+            enabled: Cpp_Misc_ThreadScheduler.policy !== 0
+          } SpinBox {
+            from: 1
+            to: 99
+            editable: true
+            Layout.fillWidth: true
+            value: Cpp_Misc_ThreadScheduler.priority
+            enabled: Cpp_Misc_ThreadScheduler.policy !== 0
+            onValueChanged: {
+              if (value !== Cpp_Misc_ThreadScheduler.priority)
+                Cpp_Misc_ThreadScheduler.priority = value
+            }
+          }
+
+          //
+          // CPUs of the device I/O & frame reader threads
+          //
+          Label {
+            text: qsTr("Data Thread CPUs") + ":"
+          } TextField {
+            Layout.fillWidth: true
+            placeholderText: qsTr("Any (e.g. 2-3)")
+            text: Cpp_Misc_ThreadScheduler.ingestCpus
+            onEditingFinished: {
+              if (text !== Cpp_Misc_ThreadScheduler.ingestCpus)
+                Cpp_Misc_ThreadScheduler.ingestCpus = text
+            }
+          }
+
+          //
+          // CPUs of the user interface thread
+          //
+          Label {
+            text: qsTr("User Interface CPUs") + ":"
+          } TextField {
+            Layout.fillWidth: true
+            placeholderText: qsTr("Any (e.g. 0-1)")
+            text: Cpp_Misc_ThreadScheduler.mainCpus
+            onEditingFinished: {
+              if (text !== Cpp_Misc_ThreadScheduler.mainCpus)
+                Cpp_Misc_ThreadScheduler.mainCpus = text
+            }
+          }
+        }
+      }
+
+      //
+      // Spacer
+      //
+      Item {
+        implicitHeight: 4
+        visible: Cpp_Misc_ThreadScheduler.supported
+      }
+
       //
       // Workspace settings
       //
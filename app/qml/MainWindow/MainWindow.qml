@@ -193,6 +193,9 @@ Widgets.SmartWindow {
     if (root.automaticUpdates && Cpp_UpdaterEnabled)
       Cpp_Updater.checkForUpdates(Cpp_AppUpdaterUrl)
 
+    // Measure the render latency of the dashboard with this window
+    Cpp_Misc_LatencyMonitor.setRenderWindow(root)
+
     // Obtain document title from JSON project editor & display the window
     root.updateDocumentTitle()
     root.displayWindow()
@@ -320,6 +320,14 @@ Popup {
       icon.source: "qrc:/rcc/icons/start/adjust.svg"
     }
 
+    Widgets.MenuButton {
+      expandable: false
+      Layout.fillWidth: true
+      text: qsTr("Diagnostics")
+      onClicked: app.showDiagnostics()
+      icon.source: "qrc:/rcc/icons/start/diagnostics.svg"
+    }
+
     Widgets.MenuButton {
       expandable: false
       text: qsTr("Help")
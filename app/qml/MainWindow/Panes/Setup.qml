@@ -68,6 +68,7 @@ Widgets.Pane {
     category: "SetupPanel"
     property alias csvExport: csvLogging.checked
     property alias consoleExport: consoleLogging.checked
+    property alias captureExport: captureLogging.checked
     property alias selectedDriver: driverCombo.currentIndex
   }
 
@@ -228,6 +229,24 @@ Widgets.Pane {
         }
       }
 
+      //
+      // Raw data capture
+      //
+      CheckBox {
+        id: captureLogging
+        Layout.leftMargin: -6
+        Layout.maximumHeight: 18
+        Layout.alignment: Qt.AlignLeft
+        text: qsTr("Record Raw Data")
+        Layout.maximumWidth: root.maxItemWidth
+        checked: Cpp_IO_CaptureExport.exportEnabled
+
+        onCheckedChanged:  {
+          if (Cpp_IO_CaptureExport.exportEnabled !== checked)
+            Cpp_IO_CaptureExport.exportEnabled = checked
+        }
+      }
+
       //
       // Spacer
       //
@@ -262,6 +281,22 @@ Widgets.Pane {
         Layout.fillWidth: true
         Layout.fillHeight: true
       }
+
+      //
+      // Frames & bytes dropped by the data pipeline
+      //
+      Label {
+        opacity: 0.8
+        elide: Label.ElideRight
+        Layout.fillWidth: true
+        Layout.maximumWidth: root.maxItemWidth
+        visible: Cpp_IO_Manager.isConnected
+        font: Cpp_Misc_CommonFonts.customUiFont(0.8, false)
+        text: qsTr("Dropped: %1 frames (%2 bytes), %3 input bytes")
+              .arg(Cpp_IO_Manager.droppedFrames)
+              .arg(Cpp_IO_Manager.droppedBytes)
+              .arg(Cpp_IO_Manager.ingressDroppedBytes)
+      }
     }
   }
 }
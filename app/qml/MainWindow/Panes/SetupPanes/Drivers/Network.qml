@@ -39,6 +39,7 @@ Item {
     property alias udpRemotePort: _udpRemotePort.text
     property alias socketType: _typeCombo.currentIndex
     property alias udpMulticastEnabled: _udpMulticast.checked
+    property alias udpReceiveBufferSize: _udpReceiveBuffer.value
   }
 
   //
@@ -237,6 +238,46 @@ Item {
             Cpp_IO_Network.udpMulticast = checked
         }
       }
+
+      //
+      // UDP receive buffer size
+      //
+      Label {
+        opacity: enabled ? 1 : 0.5
+        text: qsTr("Receive Buffer (KB)") + ":"
+        enabled: !Cpp_IO_Manager.isConnected
+        visible: Cpp_IO_Network.socketTypeIndex === 1
+      } SpinBox {
+        id: _udpReceiveBuffer
+        from: 0
+        to: 524288
+        editable: true
+        Layout.fillWidth: true
+        opacity: enabled ? 1 : 0.5
+        enabled: !Cpp_IO_Manager.isConnected
+        visible: Cpp_IO_Network.socketTypeIndex === 1
+        value: Cpp_IO_Network.udpReceiveBufferSize
+        onValueChanged: {
+          if (value !== Cpp_IO_Network.udpReceiveBufferSize)
+            Cpp_IO_Network.udpReceiveBufferSize = value
+        }
+      }
+
+      //
+      // Datagrams dropped by the kernel
+      //
+      Label {
+        text: qsTr("Kernel Drops") + ":"
+        visible: Cpp_IO_Network.socketTypeIndex === 1 &&
+                 Cpp_IO_Network.udpKernelDropsAvailable &&
+                 Cpp_IO_Manager.isConnected
+      } Label {
+        Layout.fillWidth: true
+        text: Cpp_IO_Network.udpKernelDrops
+        visible: Cpp_IO_Network.socketTypeIndex === 1 &&
+                 Cpp_IO_Network.udpKernelDropsAvailable &&
+                 Cpp_IO_Manager.isConnected
+      }
     }
 
     //
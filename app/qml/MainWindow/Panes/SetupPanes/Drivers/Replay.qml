@@ -0,0 +1,167 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+import QtCore
+import QtQuick
+import QtQuick.Layouts
+import QtQuick.Controls
+
+Item {
+  id: root
+  implicitHeight: layout.implicitHeight
+
+  //
+  // Save settings
+  //
+  Settings {
+    id: _settings
+    category: "ReplayDriver"
+    property string filePath: ""
+    property alias speed: _speed.value
+    property alias asFastAsPossible: _asFast.checked
+  }
+
+  //
+  // Restore the last capture file & save it when it changes
+  //
+  Component.onCompleted: {
+    if (_settings.filePath.length > 0)
+      Cpp_IO_Replay.filePath = _settings.filePath
+  }
+  Connections {
+    target: Cpp_IO_Replay
+
+    function onFilePathChanged() {
+      _settings.filePath = Cpp_IO_Replay.filePath
+    }
+  }
+
+  //
+  // Layout
+  //
+  ColumnLayout {
+    id: layout
+    anchors.margins: 0
+    anchors.fill: parent
+
+    GridLayout {
+      columns: 2
+      rowSpacing: 4
+      columnSpacing: 4
+      Layout.fillWidth: true
+
+      //
+      // Capture file
+      //
+      Label {
+        opacity: enabled ? 1 : 0.5
+        text: qsTr("Capture File") + ":"
+        enabled: !Cpp_IO_Manager.isConnected
+      } RowLayout {
+        spacing: 4
+        Layout.fillWidth: true
+
+        TextField {
+          readOnly: true
+          Layout.fillWidth: true
+          opacity: enabled ? 1 : 0.5
+          text: Cpp_IO_Replay.fileName
+          enabled: !Cpp_IO_Manager.isConnected
+        }
+
+        Button {
+          icon.width: 16
+          icon.height: 16
+          implicitWidth: 24
+          implicitHeight: 24
+          opacity: enabled ? 1 : 0.5
+          enabled: !Cpp_IO_Manager.isConnected
+          onClicked: Cpp_IO_Replay.browse()
+          icon.source: "qrc:/rcc/icons/buttons/open.svg"
+          icon.color: Cpp_ThemeManager.colors["button_text"]
+        }
+      }
+
+      //
+      // Playback speed
+      //
+      Label {
+        opacity: enabled ? 1 : 0.5
+        text: qsTr("Speed (%)") + ":"
+        enabled: !Cpp_IO_Manager.isConnected && !_asFast.checked
+      } SpinBox {
+        id: _speed
+        from: 1
+        to: 100000
+        editable: true
+        stepSize: 25
+        Layout.fillWidth: true
+        opacity: enabled ? 1 : 0.5
+        value: Math.round(Cpp_IO_Replay.speed * 100)
+        enabled: !Cpp_IO_Manager.isConnected && !_asFast.checked
+        onValueChanged: {
+          if (value !== Math.round(Cpp_IO_Replay.speed * 100))
+            Cpp_IO_Replay.speed = value / 100
+        }
+      }
+
+      //
+      // As fast as possible checkbox
+      //
+      Label {
+        opacity: enabled ? 1 : 0.5
+        text: qsTr("As Fast As Possible") + ":"
+        enabled: !Cpp_IO_Manager.isConnected
+      } CheckBox {
+        id: _asFast
+        opacity: enabled ? 1 : 0.5
+        Layout.alignment: Qt.AlignLeft
+        Layout.leftMargin: -8
+        checked: Cpp_IO_Replay.asFastAsPossible
+        enabled: !Cpp_IO_Manager.isConnected
+        onCheckedChanged: {
+          if (Cpp_IO_Replay.asFastAsPossible !== checked)
+            Cpp_IO_Replay.asFastAsPossible = checked
+        }
+      }
+
+      //
+      // End of capture indicator
+      //
+      Label {
+        text: qsTr("Status") + ":"
+        visible: Cpp_IO_Manager.isConnected
+      } Label {
+        Layout.fillWidth: true
+        visible: Cpp_IO_Manager.isConnected
+        text: Cpp_IO_Replay.finished ? qsTr("Replay finished") :
+                                       qsTr("Replaying...")
+      }
+    }
+
+    //
+    // Spacer
+    //
+    Item {
+      Layout.fillHeight: true
+    }
+  }
+}
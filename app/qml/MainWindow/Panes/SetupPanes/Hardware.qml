@@ -94,6 +94,18 @@ Rectangle {
       }
     }
 
+    Loader {
+      active: true
+      asynchronous: true
+      Layout.fillWidth: true
+      Layout.fillHeight: true
+      sourceComponent: Component {
+        Drivers.Replay {
+          Component.onCompleted: root.buses.push(this)
+        }
+      }
+    }
+
     Loader {
       asynchronous: true
       Layout.fillWidth: true
@@ -94,6 +94,11 @@ Item {
       source: "qrc:/serial-studio.com/gui/qml/Dialogs/Acknowledgements.qml"
     }
 
+    DialogLoader {
+      id: diagnosticsDialog
+      source: "qrc:/serial-studio.com/gui/qml/Dialogs/Diagnostics.qml"
+    }
+
     DialogLoader {
       id: fileTransmissionDialog
       source: "qrc:/serial-studio.com/gui/qml/Dialogs/FileTransmission.qml"
@@ -124,6 +129,7 @@ Item {
   // Dialog display functions (FOSS)
   //
   function showAboutDialog()       { aboutDialog.activate() }
+  function showDiagnostics()       { diagnosticsDialog.activate() }
   function showExternalConsole()   { externalConsole.activate() }
   function showSettingsDialog()    { settingsDialog.showNormal() }
   function showProjectEditor()     { projectEditor.displayWindow() }
@@ -6,13 +6,43 @@
  *
  * @param[in]  frame   A string containing the data frame.
  *                     Example: "value1,value2,value3"
+ *                     With the "Binary" decoding method, a Uint8Array with
+ *                     the bytes of the frame instead.
  *
  * @return     An array of strings with the split elements.
  *             Example: ["value1", "value2", "value3"]
  *
  * @note You can declare global variables outside this function if needed
  *       for storing settings or keeping state between calls.
+ *
+ * @note If "Parallel Parsing" is enabled in the project, frames are parsed by
+ *       several threads, each with its own copy of the global variables.
  */
 function parse(frame) {
     return frame.split(',');
 }
+
+/**
+ * Optional: parses all the frames received at once with a single call.
+ *
+ * When this function is declared, Serial Studio calls it instead of parse()
+ * and writes the returned numbers straight into the datasets, which avoids
+ * converting the result of each frame to an array of strings.
+ *
+ * @param[in]  frames  An array with the data frames.
+ *                     Example: ["1,2,3", "4,5,6"]
+ *                     With the "Binary" decoding method, an array of
+ *                     Uint8Array objects instead.
+ *
+ * @return     A flat array of numbers (or a typed array, such as a
+ *             Float64Array) with the same number of values for each frame.
+ *             Example: [1, 2, 3, 4, 5, 6]
+ *
+ * function parseBatch(frames) {
+ *     const values = [];
+ *     for (const frame of frames)
+ *         values.push(...frame.split(',').map(Number));
+ *
+ *     return values;
+ * }
+ */
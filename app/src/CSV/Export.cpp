@@ -93,8 +93,8 @@ void CSV::Export::setupExternalConnections()
 {
   connect(&IO::Manager::instance(), &IO::Manager::connectedChanged, this,
           &Export::closeFile);
-  connect(&JSON::FrameBuilder::instance(), &JSON::FrameBuilder::frameChanged,
-          this, &Export::registerFrame, Qt::QueuedConnection);
+  connect(&JSON::FrameBuilder::instance(), &JSON::FrameBuilder::framesChanged,
+          this, &Export::registerFrames, Qt::QueuedConnection);
   connect(&Misc::TimerEvents::instance(), &Misc::TimerEvents::timeout1Hz, this,
           &Export::writeValues);
   connect(&IO::Manager::instance(), &IO::Manager::pausedChanged, this, [=] {
@@ -311,9 +311,11 @@ CSV::Export::createCsvFile(const CSV::TimestampFrame &frame)
 }
 
 /**
- * Appends the latest frame from the device to the output buffer.
+ * Appends the latest frames from the device to the output buffer. The RX date
+ * & time of each frame is derived from the moment its data was received, not
+ * from the moment the batch reached this class.
  */
-void CSV::Export::registerFrame(const JSON::Frame &frame)
+void CSV::Export::registerFrames(const JSON::FrameBatch &batch)
 {
   // Ignore if CSV export is disabled
   if (!exportEnabled())
@@ -323,10 +325,6 @@ void CSV::Export::registerFrame(const JSON::Frame &frame)
   if (CSV::Player::instance().isOpen())
     return;
 
-  // Ignore if frame is invalid
-  if (!frame.isValid())
-    return;
-
   // Don't save CSV data when the device/service is not connected
 #ifdef USE_QT_COMMERCIAL
   if (!IO::Manager::instance().isConnected()
@@ -338,9 +336,21 @@ void CSV::Export::registerFrame(const JSON::Frame &frame)
     return;
 #endif
 
-  // Register raw frame to list
-  TimestampFrame tframe;
-  tframe.data = frame;
-  tframe.rxDateTime = QDateTime::currentDateTime();
-  m_frames.append(tframe);
+  // Convert monotonic ingress timestamps to wall-clock time
+  const auto now = QDateTime::currentDateTime();
+  const auto steadyNow = IO::monotonicTimestamp();
+
+  // Register valid frames to list
+  for (qsizetype i = 0; i < batch.frames.size(); ++i)
+  {
+    const auto &frame = batch.frames.at(i);
+    if (!frame.isValid())
+      continue;
+
+    TimestampFrame tframe;
+    tframe.data = frame;
+    tframe.rxDateTime
+        = now.addMSecs(-(steadyNow - batch.timestamps.at(i)) / 1000000);
+    m_frames.append(tframe);
+  }
 }
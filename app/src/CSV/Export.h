@@ -89,7 +89,7 @@ public slots:
 
 private slots:
   void writeValues();
-  void registerFrame(const JSON::Frame &frame);
+  void registerFrames(const JSON::FrameBatch &batch);
 
 private:
   QVector<QPair<int, QString>> createCsvFile(const CSV::TimestampFrame &frame);
@@ -0,0 +1,327 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "IO/Capture.h"
+
+#include <QtEndian>
+#include <QObject>
+#include <cstring>
+
+//------------------------------------------------------------------------------
+// Capture reader
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Creates a closed capture reader.
+ */
+IO::Capture::Reader::Reader()
+  : m_end(0)
+  , m_offset(0)
+  , m_data(nullptr)
+{
+}
+
+/**
+ * @brief Unmaps and closes the capture file.
+ */
+IO::Capture::Reader::~Reader()
+{
+  close();
+}
+
+/**
+ * @brief Returns @c true if a capture file is mapped.
+ */
+bool IO::Capture::Reader::isOpen() const
+{
+  return m_data != nullptr;
+}
+
+/**
+ * @brief Returns a description of the last error of `open()`.
+ */
+QString IO::Capture::Reader::errorString() const
+{
+  return m_error;
+}
+
+/**
+ * @brief Maps the capture file at @a path and validates its header.
+ *
+ * @return @c true if the file is a capture that can be replayed.
+ */
+bool IO::Capture::Reader::open(const QString &path)
+{
+  // Close the current file
+  close();
+
+  // Open the file
+  m_file.setFileName(path);
+  if (!m_file.open(QFile::ReadOnly))
+  {
+    m_error = m_file.errorString();
+    return false;
+  }
+
+  // Map the whole file
+  const auto size = m_file.size();
+  auto *data = size >= kHeaderSize ? m_file.map(0, size) : nullptr;
+  if (!data || std::memcmp(data, kMagic, sizeof(kMagic)) != 0)
+  {
+    m_error = QObject::tr("The file is not a raw data capture");
+    close();
+    return false;
+  }
+
+  // Validate the format version & header size
+  const auto version = qFromLittleEndian<quint32>(data + 8);
+  const auto headerSize = qFromLittleEndian<quint32>(data + 12);
+  const auto dataSize = qFromLittleEndian<qint64>(data + 16);
+  if (version != kVersion || headerSize < kHeaderSize || headerSize > size)
+  {
+    m_error = QObject::tr("Unsupported capture format version");
+    close();
+    return false;
+  }
+
+  // Captures that were not finalized end at the first empty record
+  m_data = data;
+  m_offset = headerSize;
+  m_end = size;
+  if (dataSize > 0 && dataSize <= size - headerSize)
+    m_end = headerSize + dataSize;
+
+  m_error.clear();
+  return true;
+}
+
+/**
+ * @brief Unmaps and closes the capture file, invalidating all records.
+ */
+void IO::Capture::Reader::close()
+{
+  if (m_data)
+    m_file.unmap(const_cast<uchar *>(m_data));
+
+  m_file.close();
+  m_data = nullptr;
+  m_offset = 0;
+  m_end = 0;
+}
+
+/**
+ * @brief Moves back to the first record of the capture.
+ */
+void IO::Capture::Reader::rewind()
+{
+  if (m_data)
+    m_offset = qFromLittleEndian<quint32>(m_data + 12);
+}
+
+/**
+ * @brief Reads the next record of the capture.
+ *
+ * @return @c false if there are no more records, or if the last record is
+ *         truncated.
+ */
+bool IO::Capture::Reader::next(Record &record)
+{
+  if (!m_data || m_end - m_offset < kRecordHeaderSize)
+    return false;
+
+  // Read the record header
+  const auto *header = m_data + m_offset;
+  const auto size = qFromLittleEndian<quint32>(header + 8);
+  if (size == 0 || m_end - m_offset - kRecordHeaderSize < size)
+    return false;
+
+  // Point the record to the mapped data
+  record.timestamp = qFromLittleEndian<qint64>(header);
+  record.data = reinterpret_cast<const char *>(header + kRecordHeaderSize);
+  record.size = size;
+
+  m_offset += kRecordHeaderSize + size;
+  return true;
+}
+
+//------------------------------------------------------------------------------
+// Capture writer
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Creates a closed capture writer.
+ */
+IO::Capture::Writer::Writer()
+  : m_data(nullptr)
+  , m_offset(0)
+  , m_capacity(0)
+{
+}
+
+/**
+ * @brief Finalizes and closes the capture file.
+ */
+IO::Capture::Writer::~Writer()
+{
+  close();
+}
+
+/**
+ * @brief Returns @c true if a capture file is being written.
+ */
+bool IO::Capture::Writer::isOpen() const
+{
+  return m_data != nullptr;
+}
+
+/**
+ * @brief Returns the number of bytes written so far, header included.
+ */
+qint64 IO::Capture::Writer::size() const
+{
+  return m_offset;
+}
+
+/**
+ * @brief Returns a description of the last error of the writer.
+ */
+QString IO::Capture::Writer::errorString() const
+{
+  return m_error;
+}
+
+/**
+ * @brief Creates the capture file at @a path and writes its header.
+ *
+ * @param path     Location of the file, replaced if it exists.
+ * @param capacity Number of bytes to preallocate.
+ *
+ * @return @c true if the file was created and mapped.
+ */
+bool IO::Capture::Writer::open(const QString &path, const qint64 capacity)
+{
+  // Close the current file
+  close();
+
+  // Create the file
+  m_file.setFileName(path);
+  if (!m_file.open(QFile::ReadWrite | QFile::Truncate))
+  {
+    m_error = m_file.errorString();
+    return false;
+  }
+
+  // Preallocate & map the file
+  m_offset = kHeaderSize;
+  if (!reserve(qMax(capacity, kHeaderSize + kRecordHeaderSize)))
+  {
+    close();
+    return false;
+  }
+
+  // Write the header, the size of the records is written when closing
+  std::memcpy(m_data, kMagic, sizeof(kMagic));
+  qToLittleEndian<quint32>(kVersion, m_data + 8);
+  qToLittleEndian<quint32>(static_cast<quint32>(kHeaderSize), m_data + 12);
+  qToLittleEndian<qint64>(0, m_data + 16);
+  qToLittleEndian<qint64>(0, m_data + 24);
+
+  m_error.clear();
+  return true;
+}
+
+/**
+ * @brief Stores the size of the records, trims the preallocated space and
+ *        closes the capture file.
+ */
+void IO::Capture::Writer::close()
+{
+  if (m_data)
+  {
+    qToLittleEndian<qint64>(m_offset - kHeaderSize, m_data + 16);
+    m_file.unmap(m_data);
+    m_file.resize(m_offset);
+  }
+
+  m_file.close();
+  m_data = nullptr;
+  m_offset = 0;
+  m_capacity = 0;
+}
+
+/**
+ * @brief Appends a record with @a size bytes of @a data, received at the
+ *        monotonic @a timestamp (in nanoseconds).
+ *
+ * @return @c false if the file could not grow to fit the record.
+ */
+bool IO::Capture::Writer::append(const qint64 timestamp, const char *data,
+                                 const quint32 size)
+{
+  // Empty records would mark the end of the capture
+  if (!m_data || size == 0)
+    return m_data != nullptr;
+
+  // Grow the file if required
+  const auto bytes = kRecordHeaderSize + size;
+  if (m_offset + bytes > m_capacity)
+  {
+    if (!reserve(qMax(m_capacity * 2, m_offset + bytes)))
+      return false;
+  }
+
+  // Copy the record, the length is written last to commit it
+  auto *record = m_data + m_offset;
+  qToLittleEndian<qint64>(timestamp, record);
+  std::memcpy(record + kRecordHeaderSize, data, size);
+  qToLittleEndian<quint32>(size, record + 8);
+
+  m_offset += bytes;
+  return true;
+}
+
+/**
+ * @brief Resizes the file to @a bytes and maps it again.
+ */
+bool IO::Capture::Writer::reserve(const qint64 bytes)
+{
+  // Unmap the current region
+  if (m_data)
+  {
+    m_file.unmap(m_data);
+    m_data = nullptr;
+  }
+
+  // Resize & map the file
+  if (m_file.resize(bytes))
+    m_data = m_file.map(0, bytes);
+
+  // Report errors
+  if (!m_data)
+  {
+    m_error = m_file.errorString();
+    m_capacity = 0;
+    return false;
+  }
+
+  m_capacity = bytes;
+  return true;
+}
@@ -0,0 +1,144 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <QFile>
+#include <QString>
+
+namespace IO
+{
+/**
+ * @brief Layout of raw byte capture files.
+ *
+ * A capture starts with a fixed-size header, followed by one record per chunk
+ * of data received from the device. All integers are little-endian:
+ *
+ * | Offset | Size | Field                                            |
+ * |--------|------|--------------------------------------------------|
+ * | 0      | 8    | Magic bytes (`kMagic`)                           |
+ * | 8      | 4    | Format version (`kVersion`)                      |
+ * | 12     | 4    | Header size, offset of the first record          |
+ * | 16     | 8    | Size of the records, 0 if the capture was cut    |
+ * | 24     | 8    | Reserved                                         |
+ *
+ * Each record holds the monotonic timestamp of the data in nanoseconds (8
+ * bytes), the number of data bytes (4 bytes) and the data itself. A record
+ * with zero length marks the end of the capture, so that files that were
+ * preallocated and never finalized can still be read.
+ */
+namespace Capture
+{
+constexpr char kMagic[8] = {'S', 'S', 'C', 'A', 'P', 'T', 'U', 'R'};
+constexpr quint32 kVersion = 1;
+constexpr qint64 kHeaderSize = 32;
+constexpr qint64 kRecordHeaderSize = 12;
+
+/**
+ * @brief A chunk of data read from a capture file.
+ *
+ * @c data points into the memory-mapped file, and stays valid until the
+ * reader is closed.
+ */
+struct Record
+{
+  qint64 timestamp = 0;       /**< Monotonic time of the data (ns). */
+  const char *data = nullptr; /**< First byte of the data. */
+  quint32 size = 0;           /**< Number of data bytes. */
+};
+
+/**
+ * @class IO::Capture::Reader
+ * @brief Iterates over the records of a capture file.
+ *
+ * The file is memory-mapped, so that captures larger than the available RAM
+ * can be replayed, and records are returned without copying their data.
+ */
+class Reader
+{
+public:
+  Reader();
+  ~Reader();
+
+  Reader(Reader &&) = delete;
+  Reader(const Reader &) = delete;
+  Reader &operator=(Reader &&) = delete;
+  Reader &operator=(const Reader &) = delete;
+
+  [[nodiscard]] bool isOpen() const;
+  [[nodiscard]] QString errorString() const;
+
+  bool open(const QString &path);
+  void close();
+  void rewind();
+  bool next(Record &record);
+
+private:
+  QFile m_file;
+  QString m_error;
+
+  qint64 m_end;
+  qint64 m_offset;
+  const uchar *m_data;
+};
+
+/**
+ * @class IO::Capture::Writer
+ * @brief Appends records to a capture file.
+ *
+ * The file is preallocated and memory-mapped, so that appending a record is a
+ * plain memory copy. When the file is full, it grows by doubling its size.
+ * The length of each record is written after its data, and the preallocated
+ * space is zero-filled, so that the records written before a crash can still
+ * be read. `close()` stores the size of the records and trims the file.
+ */
+class Writer
+{
+public:
+  Writer();
+  ~Writer();
+
+  Writer(Writer &&) = delete;
+  Writer(const Writer &) = delete;
+  Writer &operator=(Writer &&) = delete;
+  Writer &operator=(const Writer &) = delete;
+
+  [[nodiscard]] bool isOpen() const;
+  [[nodiscard]] qint64 size() const;
+  [[nodiscard]] QString errorString() const;
+
+  bool open(const QString &path, const qint64 capacity = 64 * 1024 * 1024);
+  void close();
+  bool append(const qint64 timestamp, const char *data, const quint32 size);
+
+private:
+  bool reserve(const qint64 bytes);
+
+private:
+  QFile m_file;
+  QString m_error;
+
+  uchar *m_data;
+  qint64 m_offset;
+  qint64 m_capacity;
+};
+} // namespace Capture
+} // namespace IO
@@ -0,0 +1,241 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "IO/CaptureExport.h"
+
+#include <QDir>
+#include <QDateTime>
+#include <QStandardPaths>
+
+#include "AppInfo.h"
+#include "IO/Manager.h"
+#include "Misc/Utilities.h"
+
+/**
+ * Constructor function, configures the path in which Serial Studio shall
+ * automatically write raw data captures, and starts the writer thread.
+ */
+IO::CaptureExport::CaptureExport()
+  : m_exportEnabled(false)
+  , m_open(false)
+{
+  m_filePath = QStringLiteral("%1/%2/Captures")
+                   .arg(QStandardPaths::writableLocation(
+                            QStandardPaths::DocumentsLocation),
+                        APP_NAME);
+
+  m_worker.moveToThread(&m_thread);
+  m_thread.setObjectName(QStringLiteral("Capture Writer"));
+  m_thread.start();
+}
+
+/**
+ * Finalizes the capture file & stops the writer thread before destroying the
+ * class.
+ */
+IO::CaptureExport::~CaptureExport()
+{
+  closeFile();
+
+  m_thread.quit();
+  if (!m_thread.wait(1000))
+    m_thread.terminate();
+}
+
+/**
+ * Returns a pointer to the only instance of this class.
+ */
+IO::CaptureExport &IO::CaptureExport::instance()
+{
+  static CaptureExport instance;
+  return instance;
+}
+
+/**
+ * Returns @c true if a capture file is being written.
+ */
+bool IO::CaptureExport::isOpen() const
+{
+  return m_open;
+}
+
+/**
+ * Returns @c true if raw data recording is enabled.
+ */
+bool IO::CaptureExport::exportEnabled() const
+{
+  return m_exportEnabled;
+}
+
+/**
+ * Stops recording, writes all pending data & finalizes the capture file.
+ */
+void IO::CaptureExport::closeFile()
+{
+  // Stop receiving data from the driver
+  if (m_driver)
+    disconnect(m_driver, nullptr, this, nullptr);
+
+  m_driver = nullptr;
+  if (!m_open.exchange(false))
+    return;
+
+  // Append the pending records & close the file in the writer thread
+  if (m_thread.isRunning())
+    QMetaObject::invokeMethod(
+        &m_worker, [=] { m_writer.close(); }, Qt::BlockingQueuedConnection);
+  else
+    m_writer.close();
+
+  Q_EMIT openChanged();
+}
+
+/**
+ * Configures the signal/slot connections with the modules of the application
+ * that this module depends upon.
+ */
+void IO::CaptureExport::setupExternalConnections()
+{
+  connect(&IO::Manager::instance(), &IO::Manager::connectedChanged, this,
+          &IO::CaptureExport::onConnectedChanged);
+}
+
+/**
+ * Enables or disables raw data recording.
+ */
+void IO::CaptureExport::setExportEnabled(const bool enabled)
+{
+  m_exportEnabled = enabled;
+  Q_EMIT enabledChanged();
+
+  if (!exportEnabled() && isOpen())
+    closeFile();
+}
+
+/**
+ * Creates a new capture file based on the current date/time, and starts
+ * recording the data received by the driver of the main device.
+ */
+void IO::CaptureExport::createFile()
+{
+  // Close current file (if any)
+  if (isOpen())
+    closeFile();
+
+  // Get the driver of the main device
+  auto *driver = IO::Manager::instance().driver();
+  if (!driver)
+    return;
+
+  // Get filename
+  const auto dateTime = QDateTime::currentDateTime();
+  const auto fileName
+      = dateTime.toString(QStringLiteral("yyyy_MMM_dd HH_mm_ss"))
+        + QStringLiteral(".sscap");
+
+  // Generate file path if required
+  QDir dir(m_filePath);
+  if (!dir.exists())
+    dir.mkpath(QStringLiteral("."));
+
+  // Create & map the file in the writer thread
+  bool opened = false;
+  const auto path = dir.filePath(fileName);
+  QMetaObject::invokeMethod(
+      &m_worker, [&] { opened = m_writer.open(path); },
+      Qt::BlockingQueuedConnection);
+
+  if (!opened)
+  {
+    Misc::Utilities::showMessageBox(tr("Capture File Error"),
+                                    tr("Cannot open file for writing!"),
+                                    QMessageBox::Critical);
+    return;
+  }
+
+  // Timestamp the data in the thread that received it
+  m_driver = driver;
+  connect(driver, &IO::HAL_Driver::dataReceived, this,
+          &IO::CaptureExport::registerData, Qt::DirectConnection);
+  connect(driver, &IO::HAL_Driver::datagramsReceived, this,
+          &IO::CaptureExport::registerDatagrams, Qt::DirectConnection);
+
+  // Emit signals
+  m_open = true;
+  Q_EMIT openChanged();
+}
+
+/**
+ * Starts recording when a device is connected, and finalizes the capture file
+ * when the device is disconnected.
+ */
+void IO::CaptureExport::onConnectedChanged()
+{
+  const bool connected = IO::Manager::instance().isConnected();
+  if (connected && exportEnabled() && !isOpen())
+    createFile();
+  else if (!connected && isOpen())
+    closeFile();
+}
+
+/**
+ * Timestamps the given chunk of data and hands it to the writer thread.
+ * Called in the thread that received the data.
+ */
+void IO::CaptureExport::registerData(const QByteArray &data)
+{
+  if (data.isEmpty() || !m_open)
+    return;
+
+  const auto timestamp = IO::monotonicTimestamp();
+  QMetaObject::invokeMethod(
+      &m_worker,
+      [=] {
+        const auto size = static_cast<quint32>(data.size());
+        m_writer.append(timestamp, data.constData(), size);
+      },
+      Qt::QueuedConnection);
+}
+
+/**
+ * Timestamps the given datagrams and hands them to the writer thread, each
+ * datagram is stored in its own record. Called in the thread that received
+ * the data.
+ */
+void IO::CaptureExport::registerDatagrams(const IO::DatagramBatch &batch)
+{
+  if (batch.isEmpty() || !m_open)
+    return;
+
+  const auto timestamp = IO::monotonicTimestamp();
+  QMetaObject::invokeMethod(
+      &m_worker,
+      [=] {
+        qsizetype offset = 0;
+        for (const auto size : batch.sizes)
+        {
+          const auto *data = batch.data.constData() + offset;
+          m_writer.append(timestamp, data, static_cast<quint32>(size));
+          offset += size;
+        }
+      },
+      Qt::QueuedConnection);
+}
@@ -0,0 +1,102 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <QThread>
+#include <QObject>
+#include <QPointer>
+
+#include <atomic>
+
+#include "IO/Capture.h"
+#include "IO/FrameBatch.h"
+#include "IO/HAL_Driver.h"
+
+namespace IO
+{
+/**
+ * @brief The CaptureExport class
+ *
+ * Records the exact bytes delivered by the driver of the main device into a
+ * raw byte capture (see `IO::Capture`), which can be replayed later with the
+ * `IO::Drivers::Replay` driver.
+ *
+ * Data is timestamped in the thread that received it, and then appended to
+ * the memory-mapped capture file in a dedicated thread, so that recording has
+ * no formatting cost and never blocks device I/O or the user interface.
+ */
+class CaptureExport : public QObject
+{
+  // clang-format off
+  Q_OBJECT
+  Q_PROPERTY(bool isOpen
+             READ isOpen
+             NOTIFY openChanged)
+  Q_PROPERTY(bool exportEnabled
+             READ exportEnabled
+             WRITE setExportEnabled
+             NOTIFY enabledChanged)
+  // clang-format on
+
+signals:
+  void openChanged();
+  void enabledChanged();
+
+private:
+  explicit CaptureExport();
+  CaptureExport(CaptureExport &&) = delete;
+  CaptureExport(const CaptureExport &) = delete;
+  CaptureExport &operator=(CaptureExport &&) = delete;
+  CaptureExport &operator=(const CaptureExport &) = delete;
+
+  ~CaptureExport();
+
+public:
+  static CaptureExport &instance();
+
+  [[nodiscard]] bool isOpen() const;
+  [[nodiscard]] bool exportEnabled() const;
+
+public slots:
+  void closeFile();
+  void setupExternalConnections();
+  void setExportEnabled(const bool enabled);
+
+private slots:
+  void createFile();
+  void onConnectedChanged();
+
+private:
+  void registerData(const QByteArray &data);
+  void registerDatagrams(const IO::DatagramBatch &batch);
+
+private:
+  QString m_filePath;
+  bool m_exportEnabled;
+  std::atomic<bool> m_open;
+  QPointer<HAL_Driver> m_driver;
+
+  QThread m_thread;
+  QObject m_worker;
+  Capture::Writer m_writer;
+};
+} // namespace IO
@@ -21,37 +21,249 @@
 
 #include "IO/Checksum.h"
 
+#include <array>
+#include <cstddef>
+
+//------------------------------------------------------------------------------
+// Hardware-accelerated CRC-32 kernel (see Checksum_CLMUL.cpp)
+//------------------------------------------------------------------------------
+
+namespace IO
+{
+extern const bool kCrc32ClmulNative;
+uint32_t crc32Clmul(uint32_t crc, const char *data, size_t length);
+} // namespace IO
+
+//------------------------------------------------------------------------------
+// Lookup table generation
+//------------------------------------------------------------------------------
+
+namespace
+{
+template<typename T>
+using SliceTables = std::array<std::array<T, 256>, 8>;
+
 /**
- * @brief Computes an 8-bit CRC (Cyclic Redundancy Check) for the given data.
+ * @brief Generates slice-by-8 lookup tables for a reflected (LSB-first) CRC.
  *
- * This function calculates the CRC-8 checksum using the polynomial 0x31.
+ * Table 0 is the classic byte-wise table, table k gives the contribution of a
+ * byte that is followed by k more bytes, so that 8 bytes can be folded into
+ * the CRC register with 8 independent lookups.
  *
- * @param data Pointer to the input data array.
- * @param length Length of the input data array.
- * @return The computed 8-bit CRC checksum.
+ * @param poly The reflected CRC polynomial.
+ * @return The generated lookup tables.
  */
-uint8_t IO::crc8(const char *data, const int length)
+template<typename T>
+constexpr SliceTables<T> reflectedTables(const T poly)
+{
+  SliceTables<T> t{};
+  for (unsigned int n = 0; n < 256; ++n)
+  {
+    T crc = static_cast<T>(n);
+    for (int k = 0; k < 8; ++k)
+      crc = (crc & 1) ? static_cast<T>((crc >> 1) ^ poly)
+                      : static_cast<T>(crc >> 1);
+
+    t[0][n] = crc;
+  }
+
+  for (unsigned int n = 0; n < 256; ++n)
+  {
+    for (int k = 1; k < 8; ++k)
+      t[k][n] = static_cast<T>((t[k - 1][n] >> 8) ^ t[0][t[k - 1][n] & 0xFF]);
+  }
+
+  return t;
+}
+
+/**
+ * @brief Generates slice-by-8 lookup tables for a normal (MSB-first) CRC.
+ *
+ * @param poly The CRC polynomial.
+ * @return The generated lookup tables.
+ */
+template<typename T>
+constexpr SliceTables<T> normalTables(const T poly)
 {
-  uint8_t crc = 0xff;
-  for (int i = 0; i < length; i++)
+  constexpr int width = sizeof(T) * 8;
+  constexpr T topBit = static_cast<T>(T(1) << (width - 1));
+
+  SliceTables<T> t{};
+  for (unsigned int n = 0; n < 256; ++n)
+  {
+    T crc = static_cast<T>(n << (width - 8));
+    for (int k = 0; k < 8; ++k)
+      crc = (crc & topBit) ? static_cast<T>((crc << 1) ^ poly)
+                           : static_cast<T>(crc << 1);
+
+    t[0][n] = crc;
+  }
+
+  for (unsigned int n = 0; n < 256; ++n)
   {
-    crc ^= data[i];
-    for (int j = 0; j < 8; j++)
+    for (int k = 1; k < 8; ++k)
     {
-      if ((crc & 0x80) != 0)
-        crc = (uint8_t)((crc << 1) ^ 0x31);
-      else
-        crc <<= 1;
+      const T prev = t[k - 1][n];
+      const auto index = (prev >> (width - 8)) & 0xFF;
+      t[k][n] = static_cast<T>((width > 8 ? prev << 8 : 0) ^ t[0][index]);
     }
   }
 
+  return t;
+}
+
+constexpr auto kCrc8Tables = normalTables<uint8_t>(0x31);
+constexpr auto kCrc16Tables = normalTables<uint16_t>(0x1021);
+constexpr auto kCrc16ModbusTables = reflectedTables<uint16_t>(0xA001);
+constexpr auto kCrc32Tables = reflectedTables<uint32_t>(0xEDB88320);
+constexpr auto kCrc32cTables = reflectedTables<uint32_t>(0x82F63B78);
+
+/**
+ * @brief Reads a little-endian 32-bit word from an unaligned address.
+ */
+inline uint32_t load32(const uint8_t *p)
+{
+  return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8)
+         | (static_cast<uint32_t>(p[2]) << 16)
+         | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+/**
+ * @brief Updates a reflected 32-bit CRC register using slice-by-8.
+ */
+uint32_t sliceReflected32(const SliceTables<uint32_t> &t, uint32_t crc,
+                          const uint8_t *p, size_t length)
+{
+  for (; length >= 8; p += 8, length -= 8)
+  {
+    const uint32_t lo = crc ^ load32(p);
+    const uint32_t hi = load32(p + 4);
+    crc = t[7][lo & 0xFF] ^ t[6][(lo >> 8) & 0xFF] ^ t[5][(lo >> 16) & 0xFF]
+          ^ t[4][lo >> 24] ^ t[3][hi & 0xFF] ^ t[2][(hi >> 8) & 0xFF]
+          ^ t[1][(hi >> 16) & 0xFF] ^ t[0][hi >> 24];
+  }
+
+  for (; length > 0; ++p, --length)
+    crc = (crc >> 8) ^ t[0][(crc ^ *p) & 0xFF];
+
+  return crc;
+}
+
+/**
+ * @brief Updates a reflected 16-bit CRC register using slice-by-8.
+ */
+uint16_t sliceReflected16(const SliceTables<uint16_t> &t, uint16_t crc,
+                          const uint8_t *p, size_t length)
+{
+  for (; length >= 8; p += 8, length -= 8)
+  {
+    const auto x = static_cast<uint16_t>(crc ^ (p[0] | (p[1] << 8)));
+    crc = t[7][x & 0xFF] ^ t[6][x >> 8] ^ t[5][p[2]] ^ t[4][p[3]]
+          ^ t[3][p[4]] ^ t[2][p[5]] ^ t[1][p[6]] ^ t[0][p[7]];
+  }
+
+  for (; length > 0; ++p, --length)
+    crc = static_cast<uint16_t>((crc >> 8) ^ t[0][(crc ^ *p) & 0xFF]);
+
   return crc;
 }
 
+/**
+ * @brief Updates a normal 16-bit CRC register using slice-by-8.
+ */
+uint16_t sliceNormal16(const SliceTables<uint16_t> &t, uint16_t crc,
+                       const uint8_t *p, size_t length)
+{
+  for (; length >= 8; p += 8, length -= 8)
+  {
+    const auto b0 = static_cast<uint8_t>(p[0] ^ (crc >> 8));
+    const auto b1 = static_cast<uint8_t>(p[1] ^ (crc & 0xFF));
+    crc = t[7][b0] ^ t[6][b1] ^ t[5][p[2]] ^ t[4][p[3]] ^ t[3][p[4]]
+          ^ t[2][p[5]] ^ t[1][p[6]] ^ t[0][p[7]];
+  }
+
+  for (; length > 0; ++p, --length)
+    crc = static_cast<uint16_t>((crc << 8) ^ t[0][((crc >> 8) ^ *p) & 0xFF]);
+
+  return crc;
+}
+
+/**
+ * @brief Updates a normal 8-bit CRC register using slice-by-8.
+ */
+uint8_t sliceNormal8(const SliceTables<uint8_t> &t, uint8_t crc,
+                     const uint8_t *p, size_t length)
+{
+  for (; length >= 8; p += 8, length -= 8)
+  {
+    crc = t[7][p[0] ^ crc] ^ t[6][p[1]] ^ t[5][p[2]] ^ t[4][p[3]]
+          ^ t[3][p[4]] ^ t[2][p[5]] ^ t[1][p[6]] ^ t[0][p[7]];
+  }
+
+  for (; length > 0; ++p, --length)
+    crc = t[0][crc ^ *p];
+
+  return crc;
+}
+
+/**
+ * @brief Checks once whether the carry-less multiplication CRC-32 kernel was
+ *        compiled natively and is supported by the CPU we are running on.
+ */
+bool crc32ClmulSupported()
+{
+#if (defined(__x86_64__) || defined(__i386__))                                 \
+    && (defined(__GNUC__) || defined(__clang__))
+  static const bool supported = IO::kCrc32ClmulNative
+                                && __builtin_cpu_supports("pclmul")
+                                && __builtin_cpu_supports("sse4.1");
+  return supported;
+#else
+  return false;
+#endif
+}
+
+/**
+ * @brief Converts a signed length into a byte count.
+ */
+inline size_t byteCount(const int length)
+{
+  return length > 0 ? static_cast<size_t>(length) : 0;
+}
+
+/**
+ * @brief Reinterprets character data as unsigned bytes.
+ */
+inline const uint8_t *bytes(const char *data)
+{
+  return reinterpret_cast<const uint8_t *>(data);
+}
+} // namespace
+
+//------------------------------------------------------------------------------
+// Checksum functions
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Computes an 8-bit CRC (Cyclic Redundancy Check) for the given data.
+ *
+ * This function calculates the CRC-8 checksum using the polynomial 0x31 and an
+ * initial value of 0xFF (CRC-8/NRSC-5, check value 0xF7).
+ *
+ * @param data Pointer to the input data array.
+ * @param length Length of the input data array.
+ * @return The computed 8-bit CRC checksum.
+ */
+uint8_t IO::crc8(const char *data, const int length)
+{
+  return sliceNormal8(kCrc8Tables, 0xFF, bytes(data), byteCount(length));
+}
+
 /**
  * @brief Computes a 16-bit CRC (Cyclic Redundancy Check) for the given data.
  *
- * This function calculates the CRC-16 checksum using a bitwise algorithm.
+ * This function calculates the CRC-16/CCITT-FALSE checksum (polynomial 0x1021,
+ * initial value 0xFFFF, check value 0x29B1).
  *
  * @param data Pointer to the input data array.
  * @param length Length of the input data array.
@@ -59,42 +271,135 @@ uint8_t IO::crc8(const char *data, const int length)
  */
 uint16_t IO::crc16(const char *data, const int length)
 {
-  uint8_t x;
-  uint16_t crc = 0xFFFF;
+  return sliceNormal16(kCrc16Tables, 0xFFFF, bytes(data), byteCount(length));
+}
+
+/**
+ * @brief Computes a 32-bit CRC (Cyclic Redundancy Check) for the given data.
+ *
+ * This function calculates the standard CRC-32 checksum (reflected polynomial
+ * 0xEDB88320, check value 0xCBF43926). Large inputs are folded with carry-less
+ * multiplication when the CPU supports it.
+ *
+ * @param data Pointer to the input data array.
+ * @param length Length of the input data array.
+ * @return The computed 32-bit CRC checksum.
+ */
+uint32_t IO::crc32(const char *data, const int length)
+{
+  uint32_t crc = 0xFFFFFFFF;
+  auto count = byteCount(length);
 
-  for (int i = 0; i < length; ++i)
+  // Fold 16-byte blocks in hardware when possible
+  if (count >= 64 && crc32ClmulSupported())
   {
-    x = crc >> 8 ^ data[i];
-    x ^= x >> 4;
-    crc = (crc << 8) ^ ((uint16_t)(x << 12)) ^ ((uint16_t)(x << 5))
-          ^ ((uint16_t)x);
+    const auto blocks = count & ~static_cast<size_t>(15);
+    crc = crc32Clmul(crc, data, blocks);
+    data += blocks;
+    count -= blocks;
   }
 
-  return crc;
+  // Process the remaining bytes with lookup tables
+  return ~sliceReflected32(kCrc32Tables, crc, bytes(data), count);
 }
 
 /**
- * @brief Computes a 32-bit CRC (Cyclic Redundancy Check) for the given data.
+ * @brief Computes the 8-bit XOR of all bytes in the given data.
  *
- * This function calculates the CRC-32 checksum using the polynomial 0xEDB88320.
+ * @param data Pointer to the input data array.
+ * @param length Length of the input data array.
+ * @return The computed 8-bit XOR checksum.
+ */
+uint8_t IO::xor8(const char *data, const int length)
+{
+  uint8_t result = 0;
+  const auto *p = bytes(data);
+  for (size_t i = 0; i < byteCount(length); ++i)
+    result ^= p[i];
+
+  return result;
+}
+
+/**
+ * @brief Computes the 8-bit sum (modulo 256) of all bytes in the given data.
+ *
+ * @param data Pointer to the input data array.
+ * @param length Length of the input data array.
+ * @return The computed 8-bit sum checksum.
+ */
+uint8_t IO::sum8(const char *data, const int length)
+{
+  uint8_t result = 0;
+  const auto *p = bytes(data);
+  for (size_t i = 0; i < byteCount(length); ++i)
+    result += p[i];
+
+  return result;
+}
+
+/**
+ * @brief Computes a CRC-32C (Castagnoli) checksum for the given data.
+ *
+ * Uses the reflected polynomial 0x82F63B78 (check value 0xE3069283).
  *
  * @param data Pointer to the input data array.
  * @param length Length of the input data array.
  * @return The computed 32-bit CRC checksum.
  */
-uint32_t IO::crc32(const char *data, const int length)
+uint32_t IO::crc32c(const char *data, const int length)
 {
-  uint32_t mask;
-  uint32_t crc = 0xFFFFFFFF;
-  for (int i = 0; i < length; ++i)
+  const auto count = byteCount(length);
+  return ~sliceReflected32(kCrc32cTables, 0xFFFFFFFF, bytes(data), count);
+}
+
+/**
+ * @brief Computes a Fletcher-16 checksum for the given data.
+ *
+ * The modulo operations are deferred to once every 5802 bytes, which is the
+ * largest block for which the 32-bit running sums cannot overflow. The result
+ * holds the second sum in the high byte and the first sum in the low byte
+ * (check value 0x1EDE).
+ *
+ * @param data Pointer to the input data array.
+ * @param length Length of the input data array.
+ * @return The computed 16-bit Fletcher checksum.
+ */
+uint16_t IO::fletcher16(const char *data, const int length)
+{
+  uint32_t sum1 = 0;
+  uint32_t sum2 = 0;
+  const auto *p = bytes(data);
+  auto count = byteCount(length);
+  while (count > 0)
   {
-    crc = crc ^ data[i];
-    for (int j = 8; j >= 0; j--)
+    const auto block = count < 5802 ? count : 5802;
+    for (size_t i = 0; i < block; ++i)
     {
-      mask = 0 - (crc & 1);
-      crc = (crc >> 1) ^ (0xEDB88320 & mask);
+      sum1 += p[i];
+      sum2 += sum1;
     }
+
+    sum1 %= 255;
+    sum2 %= 255;
+    p += block;
+    count -= block;
   }
 
-  return ~crc;
+  return static_cast<uint16_t>((sum2 << 8) | sum1);
+}
+
+/**
+ * @brief Computes a CRC-16/MODBUS checksum for the given data.
+ *
+ * Uses the reflected polynomial 0xA001 and an initial value of 0xFFFF (check
+ * value 0x4B37).
+ *
+ * @param data Pointer to the input data array.
+ * @param length Length of the input data array.
+ * @return The computed 16-bit CRC checksum.
+ */
+uint16_t IO::crc16Modbus(const char *data, const int length)
+{
+  const auto count = byteCount(length);
+  return sliceReflected16(kCrc16ModbusTables, 0xFFFF, bytes(data), count);
 }
@@ -28,4 +28,10 @@ namespace IO
 [[nodiscard]] uint8_t crc8(const char *data, const int length);
 [[nodiscard]] uint16_t crc16(const char *data, const int length);
 [[nodiscard]] uint32_t crc32(const char *data, const int length);
+
+[[nodiscard]] uint8_t xor8(const char *data, const int length);
+[[nodiscard]] uint8_t sum8(const char *data, const int length);
+[[nodiscard]] uint32_t crc32c(const char *data, const int length);
+[[nodiscard]] uint16_t fletcher16(const char *data, const int length);
+[[nodiscard]] uint16_t crc16Modbus(const char *data, const int length);
 } // namespace IO
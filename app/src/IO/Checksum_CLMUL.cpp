@@ -0,0 +1,154 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+
+// simde only includes the native PCLMUL header when AES is enabled as well
+#if defined(__PCLMUL__)
+#  include <wmmintrin.h>
+#endif
+
+#include <x86/clmul.h>
+#include <x86/sse4.1.h>
+
+/*
+ * This file is compiled with PCLMUL & SSE4.1 code generation enabled (see
+ * app/CMakeLists.txt), so it must only be called after checking that the CPU
+ * supports those instructions. The caller lives in Checksum.cpp.
+ */
+
+namespace IO
+{
+extern const bool kCrc32ClmulNative;
+uint32_t crc32Clmul(uint32_t crc, const char *data, size_t length);
+} // namespace IO
+
+#if defined(SIMDE_X86_PCLMUL_NATIVE) && defined(SIMDE_X86_SSE4_1_NATIVE)
+const bool IO::kCrc32ClmulNative = true;
+#else
+const bool IO::kCrc32ClmulNative = false;
+#endif
+
+/**
+ * @brief Updates a CRC-32 register by folding 16-byte blocks with carry-less
+ *        multiplication.
+ *
+ * Implements the algorithm described in Intel's "Fast CRC Computation for
+ * Generic Polynomials Using PCLMULQDQ Instruction" white paper: four 128-bit
+ * lanes are folded in parallel over 64-byte blocks, reduced to a single lane,
+ * and finally Barrett-reduced to 32 bits. The constants are the bit-reflected
+ * values for the CRC-32 polynomial 0x04C11DB7.
+ *
+ * @param crc The current (non-inverted) CRC register.
+ * @param data Pointer to the input data.
+ * @param length Number of bytes to process, at least 64 & a multiple of 16.
+ * @return The updated (non-inverted) CRC register.
+ */
+uint32_t IO::crc32Clmul(uint32_t crc, const char *data, size_t length)
+{
+  // Folding & reduction constants
+  alignas(16) static const uint64_t k1k2[] = {0x0154442bd4, 0x01c6e41596};
+  alignas(16) static const uint64_t k3k4[] = {0x01751997d0, 0x00ccaa009e};
+  alignas(16) static const uint64_t k5k0[] = {0x0163cd6124, 0x0000000000};
+  alignas(16) static const uint64_t poly[] = {0x01db710641, 0x01f7011641};
+
+  // Load the first 64-byte block & inject the initial CRC value
+  const auto *buf = reinterpret_cast<const simde__m128i *>(data);
+  auto x1 = simde_mm_loadu_si128(buf + 0);
+  auto x2 = simde_mm_loadu_si128(buf + 1);
+  auto x3 = simde_mm_loadu_si128(buf + 2);
+  auto x4 = simde_mm_loadu_si128(buf + 3);
+  x1 = simde_mm_xor_si128(x1, simde_mm_cvtsi32_si128(static_cast<int>(crc)));
+
+  buf += 4;
+  length -= 64;
+
+  // Fold four lanes in parallel over each 64-byte block
+  auto x0 = simde_mm_load_si128(reinterpret_cast<const simde__m128i *>(k1k2));
+  while (length >= 64)
+  {
+    const auto x5 = simde_mm_clmulepi64_si128(x1, x0, 0x00);
+    const auto x6 = simde_mm_clmulepi64_si128(x2, x0, 0x00);
+    const auto x7 = simde_mm_clmulepi64_si128(x3, x0, 0x00);
+    const auto x8 = simde_mm_clmulepi64_si128(x4, x0, 0x00);
+
+    x1 = simde_mm_clmulepi64_si128(x1, x0, 0x11);
+    x2 = simde_mm_clmulepi64_si128(x2, x0, 0x11);
+    x3 = simde_mm_clmulepi64_si128(x3, x0, 0x11);
+    x4 = simde_mm_clmulepi64_si128(x4, x0, 0x11);
+
+    x1 = simde_mm_xor_si128(simde_mm_xor_si128(x1, x5),
+                            simde_mm_loadu_si128(buf + 0));
+    x2 = simde_mm_xor_si128(simde_mm_xor_si128(x2, x6),
+                            simde_mm_loadu_si128(buf + 1));
+    x3 = simde_mm_xor_si128(simde_mm_xor_si128(x3, x7),
+                            simde_mm_loadu_si128(buf + 2));
+    x4 = simde_mm_xor_si128(simde_mm_xor_si128(x4, x8),
+                            simde_mm_loadu_si128(buf + 3));
+
+    buf += 4;
+    length -= 64;
+  }
+
+  // Fold the four lanes into a single 128-bit lane
+  x0 = simde_mm_load_si128(reinterpret_cast<const simde__m128i *>(k3k4));
+  for (const auto &next : {x2, x3, x4})
+  {
+    const auto x5 = simde_mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = simde_mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = simde_mm_xor_si128(simde_mm_xor_si128(x1, next), x5);
+  }
+
+  // Fold any remaining 16-byte blocks
+  while (length >= 16)
+  {
+    const auto x5 = simde_mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = simde_mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = simde_mm_xor_si128(simde_mm_xor_si128(x1, simde_mm_loadu_si128(buf)),
+                            x5);
+
+    ++buf;
+    length -= 16;
+  }
+
+  // Fold 128 bits down to 64 bits
+  const auto mask = simde_mm_setr_epi32(~0, 0, ~0, 0);
+  x2 = simde_mm_clmulepi64_si128(x1, x0, 0x10);
+  x1 = simde_mm_xor_si128(simde_mm_srli_si128(x1, 8), x2);
+
+  x0 = simde_mm_loadl_epi64(reinterpret_cast<const simde__m128i *>(k5k0));
+  x2 = simde_mm_srli_si128(x1, 4);
+  x1 = simde_mm_and_si128(x1, mask);
+  x1 = simde_mm_clmulepi64_si128(x1, x0, 0x00);
+  x1 = simde_mm_xor_si128(x1, x2);
+
+  // Barrett reduction to 32 bits
+  x0 = simde_mm_load_si128(reinterpret_cast<const simde__m128i *>(poly));
+  x2 = simde_mm_and_si128(x1, mask);
+  x2 = simde_mm_clmulepi64_si128(x2, x0, 0x10);
+  x2 = simde_mm_and_si128(x2, mask);
+  x2 = simde_mm_clmulepi64_si128(x2, x0, 0x00);
+  x1 = simde_mm_xor_si128(x1, x2);
+
+  return static_cast<uint32_t>(simde_mm_extract_epi32(x1, 1));
+}
@@ -23,19 +23,103 @@
 
 #include <QtCore>
 
-#include <mutex>
+#include <atomic>
 #include <vector>
 #include <cstring>
+#include <stdexcept>
+
+#include "SIMD/SIMD.h"
 
 namespace IO
 {
 /**
- * @brief A generic circular buffer for managing data with fixed capacity.
+ * @brief Resumable search state for `CircularBuffer::findPatternKMP()`.
+ *
+ * Stores the precomputed longest prefix suffix (LPS) table of a pattern along
+ * with how far the buffer has already been scanned and the length of the
+ * partial match at that point. Searching with the same scanner across several
+ * calls examines each byte only once, no matter how the stream is chunked.
+ *
+ * All offsets are relative to the read position of the buffer, so the owner
+ * must call `consume()` whenever data is removed from the front of the buffer.
+ *
+ * @tparam T The pattern type (e.g., QByteArray).
+ */
+template<typename T>
+struct KMPScanner
+{
+  KMPScanner(const T &p = T()) { setPattern(p); }
+
+  void reset();
+  void setPattern(const T &p);
+  void consume(qsizetype bytes);
+
+  T pattern;            /**< Pattern to search for. */
+  std::vector<int> lps; /**< Precomputed LPS table for the pattern. */
+  qsizetype scanned;    /**< Number of bytes already examined. */
+  qsizetype matched;    /**< Partial match length at `scanned`. */
+  qsizetype found;      /**< Start of the last unconsumed match, or -1. */
+};
+
+/**
+ * @brief Single-pass search state for `CircularBuffer::findDelimiter()`.
+ *
+ * Looks for the earliest occurrence of any of a small set of delimiters. The
+ * first byte of every pattern is located with SIMD comparisons, and only those
+ * candidate positions are checked against the full patterns. When several
+ * delimiters match at the same position, the longest one wins (e.g. `\r\n`
+ * over `\r`).
+ *
+ * Markers are patterns that do not end the search; only the position of their
+ * first occurrence before the delimiter is recorded. This lets start/end
+ * framing locate both sequences in the same pass.
+ *
+ * As with `KMPScanner`, offsets are relative to the read position of the
+ * buffer, and the owner must call `consume()` whenever data is removed from the
+ * front of the buffer.
+ *
+ * @tparam T The pattern type (e.g., QByteArray).
+ */
+template<typename T>
+struct DelimiterScanner
+{
+  DelimiterScanner(const QList<T> &d = {}, const QList<T> &m = {})
+  {
+    setPatterns(d, m);
+  }
+
+  void reset();
+  void consume(qsizetype bytes);
+  void setPatterns(const QList<T> &d, const QList<T> &m = {});
+
+  QList<T> delimiters;             /**< Patterns that end the search. */
+  QList<T> markers;                /**< Patterns that are only recorded. */
+  std::vector<char> firstBytes;    /**< Unique first bytes of all patterns. */
+  std::vector<qsizetype> markerAt; /**< First position of each marker. */
+  qsizetype scanned;               /**< Number of bytes already examined. */
+  qsizetype found;                 /**< Unconsumed delimiter position, or -1. */
+  int delimiter;                   /**< Index of matched delimiter, or -1. */
+};
+
+/**
+ * @brief A lock-free single-producer/single-consumer circular buffer.
  *
  * This templated class provides a circular buffer implementation for efficient
  * storage and retrieval of elements. It supports a customizable storage type
  * for internal representation, allowing for optimized memory usage.
  *
+ * The read and write positions are monotonic counters published through
+ * acquire/release atomics, so one thread may call `append()` while another
+ * thread consumes data without any locking. Data is moved in at most two
+ * `memcpy()` calls (one per side of the wrap-around point).
+ *
+ * Thread-safety contract:
+ * - **Producer**: `append()` and `freeSpace()`.
+ * - **Consumer**: `read()`, `skip()`, `peek()`, `view()`, `clear()`,
+ *   `findPatternKMP()`, `findDelimiter()` and `operator[]`.
+ * - `setCapacity()` must only be called while no other thread is using the
+ *   buffer.
+ *
  * @tparam T The type of elements exposed to the user (e.g., QByteArray,
  *           QString).
  * @tparam StorageType The type of elements used internally in the buffer
@@ -50,31 +134,213 @@ public:
   [[nodiscard]] StorageType &operator[](qsizetype index);
 
   void clear();
-  void append(const T &data);
+  void skip(qsizetype size);
+  qsizetype append(const T &data);
+  qsizetype append(const StorageType *data, qsizetype size);
   void setCapacity(const qsizetype capacity);
 
   [[nodiscard]] qsizetype size() const;
+  [[nodiscard]] qsizetype capacity() const;
   [[nodiscard]] qsizetype freeSpace() const;
 
   [[nodiscard]] T read(qsizetype size);
   [[nodiscard]] T peek(qsizetype size) const;
+  [[nodiscard]] T view(qsizetype offset, qsizetype size);
 
   [[nodiscard]] int findPatternKMP(const T &pattern, const int pos = 0);
+  [[nodiscard]] int findPatternKMP(KMPScanner<T> &scanner, const int pos = 0);
+  [[nodiscard]] int findDelimiter(DelimiterScanner<T> &scanner);
 
 private:
-  [[nodiscard]] std::vector<int> computeKMPTable(const T &p) const;
+  [[nodiscard]] int compareAt(quint64 from, qsizetype available,
+                              const T &pattern) const;
+  void copyOut(quint64 from, qsizetype size, StorageType *dst) const;
 
 private:
-  qsizetype m_size;
-  qsizetype m_head;
-  qsizetype m_tail;
   qsizetype m_capacity;
   std::vector<StorageType> m_buffer;
+  std::vector<StorageType> m_scratch;
 
-  mutable std::mutex m_mutex;
+  alignas(64) std::atomic<quint64> m_head;
+  alignas(64) std::atomic<quint64> m_tail;
 };
 } // namespace IO
 
+/**
+ * @brief Forgets all scan progress, keeping the current pattern.
+ */
+template<typename T>
+void IO::KMPScanner<T>::reset()
+{
+  scanned = 0;
+  matched = 0;
+  found = -1;
+}
+
+/**
+ * @brief Changes the search pattern and computes its LPS table.
+ *
+ * @param p The new pattern to search for.
+ */
+template<typename T>
+void IO::KMPScanner<T>::setPattern(const T &p)
+{
+  pattern = p;
+  const qsizetype m = p.size();
+  lps.assign(m, 0);
+
+  qsizetype len = 0;
+  qsizetype i = 1;
+  while (i < m)
+  {
+    if (p[i] == p[len])
+    {
+      len++;
+      lps[i++] = len;
+    }
+
+    else if (len != 0)
+      len = lps[len - 1];
+
+    else
+      lps[i++] = 0;
+  }
+
+  reset();
+}
+
+/**
+ * @brief Updates the scan state after @a bytes were removed from the front of
+ *        the buffer.
+ *
+ * A pending match that survives the removal is kept. A partial match is only
+ * shortened (through the LPS table) when its first bytes were removed, so no
+ * byte is ever examined twice.
+ *
+ * @param bytes Number of bytes removed from the front of the buffer.
+ */
+template<typename T>
+void IO::KMPScanner<T>::consume(qsizetype bytes)
+{
+  if (bytes <= 0)
+    return;
+
+  // Keep the pending match if it is still in the buffer
+  if (found >= bytes)
+  {
+    found -= bytes;
+    scanned -= bytes;
+    return;
+  }
+
+  // Drop the part of the partial match that is no longer in the buffer
+  found = -1;
+  while (matched > 0 && scanned - matched < bytes)
+    matched = lps[matched - 1];
+
+  // Shift the scan position
+  if (scanned >= bytes)
+    scanned -= bytes;
+  else
+    reset();
+}
+
+/**
+ * @brief Forgets all scan progress, keeping the current patterns.
+ */
+template<typename T>
+void IO::DelimiterScanner<T>::reset()
+{
+  scanned = 0;
+  found = -1;
+  delimiter = -1;
+  std::fill(markerAt.begin(), markerAt.end(), -1);
+}
+
+/**
+ * @brief Changes the patterns to search for.
+ *
+ * Empty patterns are ignored during the search.
+ *
+ * @param d Delimiters, the search stops at the first one found.
+ * @param m Markers, only the first occurrence of each one is recorded.
+ */
+template<typename T>
+void IO::DelimiterScanner<T>::setPatterns(const QList<T> &d, const QList<T> &m)
+{
+  delimiters = d;
+  markers = m;
+  markerAt.assign(m.size(), -1);
+
+  // Obtain the unique first bytes of all non-empty patterns
+  firstBytes.clear();
+  for (const auto &list : {d, m})
+  {
+    for (const auto &pattern : list)
+    {
+      if (pattern.isEmpty())
+        continue;
+
+      const char byte = pattern.at(0);
+      if (std::find(firstBytes.begin(), firstBytes.end(), byte)
+          == firstBytes.end())
+        firstBytes.push_back(byte);
+    }
+  }
+
+  reset();
+}
+
+/**
+ * @brief Updates the scan state after @a bytes were removed from the front of
+ *        the buffer.
+ *
+ * If a recorded marker is removed while the scan already went past it, later
+ * occurrences of that marker may not have been recorded, so the remaining
+ * data is scanned again. This only happens when data is dropped outside of the
+ * normal frame extraction flow (e.g. on buffer overflow).
+ *
+ * @param bytes Number of bytes removed from the front of the buffer.
+ */
+template<typename T>
+void IO::DelimiterScanner<T>::consume(qsizetype bytes)
+{
+  if (bytes <= 0)
+    return;
+
+  // Shift marker positions, rescan if a marker went out of the buffer early
+  bool rescan = false;
+  for (auto &pos : markerAt)
+  {
+    if (pos >= bytes)
+      pos -= bytes;
+
+    else if (pos >= 0)
+    {
+      pos = -1;
+      rescan = scanned > bytes;
+    }
+  }
+
+  if (rescan)
+  {
+    reset();
+    return;
+  }
+
+  // Keep the pending delimiter if it is still in the buffer
+  if (found >= bytes)
+    found -= bytes;
+  else
+  {
+    found = -1;
+    delimiter = -1;
+  }
+
+  // Shift the scan position
+  scanned = std::max<qsizetype>(0, scanned - bytes);
+}
+
 /**
  * @brief Constructs a CircularBuffer object with a given capacity.
  *
@@ -85,10 +351,9 @@ private:
  */
 template<typename T, typename StorageType>
 IO::CircularBuffer<T, StorageType>::CircularBuffer(qsizetype capacity)
-  : m_size(0)
+  : m_capacity(capacity)
   , m_head(0)
   , m_tail(0)
-  , m_capacity(capacity)
 {
   m_buffer.resize(capacity);
 }
@@ -98,7 +363,8 @@ IO::CircularBuffer<T, StorageType>::CircularBuffer(qsizetype capacity)
  *
  * This subscript operator allows accessing elements stored in the circular
  * buffer at a specific logical index, taking the circular nature of the buffer
- * into account. It performs bounds checking and ensures thread-safe access.
+ * into account. It performs bounds checking and may only be called from the
+ * consumer thread.
  *
  * @param index The logical index of the element to access (0-based).
  *              Must be in the range [0, size()-1].
@@ -108,70 +374,110 @@ IO::CircularBuffer<T, StorageType>::CircularBuffer(qsizetype capacity)
 template<typename T, typename StorageType>
 StorageType &IO::CircularBuffer<T, StorageType>::operator[](qsizetype index)
 {
-  std::lock_guard<std::mutex> lock(m_mutex);
-
-  if (index < 0 || index >= m_size)
+  if (index < 0 || index >= size())
     throw std::out_of_range("Index out of range");
 
-  qsizetype effectiveIndex = (m_head + index) % m_capacity;
-  return m_buffer[effectiveIndex];
+  const auto head = m_head.load(std::memory_order_relaxed);
+  return m_buffer[(head + index) % m_capacity];
 }
 
 /**
  * @brief Clears the circular buffer.
  *
- * Resets the buffer, removing all data and resetting internal variables.
+ * Discards all data currently stored in the buffer by moving the read position
+ * up to the write position. Safe to call from the consumer thread.
  */
 template<typename T, typename StorageType>
 void IO::CircularBuffer<T, StorageType>::clear()
 {
-  std::lock_guard<std::mutex> lock(m_mutex);
-  m_size = 0;
-  m_head = 0;
-  m_tail = 0;
+  const auto tail = m_tail.load(std::memory_order_acquire);
+  m_head.store(tail, std::memory_order_release);
 }
 
 /**
- * @brief Appends data to the circular buffer.
+ * @brief Discards the given number of elements from the front of the buffer.
  *
- * Adds the given data to the buffer. If the data exceeds the free space, old
- * data is overwritten.
+ * This is the zero-copy counterpart of `read()`, used once the consumer is
+ * done with a `view()` of the data.
+ *
+ * @param size The number of elements to discard.
+ * @throws std::underflow_error if there is not enough data in the buffer.
+ */
+template<typename T, typename StorageType>
+void IO::CircularBuffer<T, StorageType>::skip(qsizetype size)
+{
+  if (size < 0 || size > this->size())
+    throw std::underflow_error("Not enough data in buffer");
+
+  const auto head = m_head.load(std::memory_order_relaxed);
+  m_head.store(head + size, std::memory_order_release);
+}
+
+/**
+ * @brief Appends data to the circular buffer.
  *
  * @param data The QByteArray containing data to append.
+ * @return The number of elements that were actually stored.
  * @throws std::overflow_error if the data size exceeds the buffer capacity.
+ *
+ * @see append(const StorageType *, qsizetype)
  */
 template<typename T, typename StorageType>
-void IO::CircularBuffer<T, StorageType>::append(const T &data)
+qsizetype IO::CircularBuffer<T, StorageType>::append(const T &data)
 {
-  std::lock_guard<std::mutex> lock(m_mutex);
+  const auto *ptr = reinterpret_cast<const StorageType *>(data.constData());
+  return append(ptr, data.size());
+}
 
-  qsizetype dataSize = data.size();
-  if (dataSize > m_capacity)
+/**
+ * @brief Appends raw data to the circular buffer.
+ *
+ * Copies the given data into the buffer using at most two `memcpy()` calls and
+ * publishes it to the consumer. The producer never moves the read position, so
+ * if there is not enough free space only the elements that fit are stored; the
+ * consumer is expected to make room beforehand with `skip()`.
+ *
+ * @param data Pointer to the data to append.
+ * @param size Number of elements to append.
+ * @return The number of elements that were actually stored.
+ * @throws std::overflow_error if the data size exceeds the buffer capacity.
+ */
+template<typename T, typename StorageType>
+qsizetype IO::CircularBuffer<T, StorageType>::append(const StorageType *data,
+                                                     qsizetype size)
+{
+  if (size > m_capacity)
     throw std::overflow_error("Data size exceeds buffer capacity");
 
-  if (freeSpace() < dataSize)
-  {
-    qsizetype overwrite = dataSize - freeSpace();
-    m_head = (m_head + overwrite) % m_capacity;
-    m_size -= overwrite;
-  }
+  // Only write what fits, never overwrite data the consumer may be reading
+  size = std::min(size, freeSpace());
+  if (size <= 0)
+    return 0;
 
-  for (qsizetype i = 0; i < dataSize; ++i)
-  {
-    m_buffer[m_tail] = data[i];
-    m_tail = (m_tail + 1) % m_capacity;
-  }
+  // Copy data in up to two chunks
+  const auto tail = m_tail.load(std::memory_order_relaxed);
+  const auto start = static_cast<qsizetype>(tail % m_capacity);
+  const auto firstChunk = std::min(size, m_capacity - start);
+  std::memcpy(m_buffer.data() + start, data, firstChunk * sizeof(StorageType));
+  if (size > firstChunk)
+    std::memcpy(m_buffer.data(), data + firstChunk,
+                (size - firstChunk) * sizeof(StorageType));
 
-  m_size += dataSize;
+  // Publish the new data to the consumer
+  m_tail.store(tail + size, std::memory_order_release);
+  return size;
 }
 
 /**
  * Clears the buffer and modifies it's maximum capacity.
+ *
+ * @warning Not thread-safe, only call while the buffer is idle.
  */
 template<typename T, typename StorageType>
 void IO::CircularBuffer<T, StorageType>::setCapacity(const qsizetype capacity)
 {
-  clear();
+  m_head.store(0);
+  m_tail.store(0);
   m_capacity = capacity;
   m_buffer.resize(capacity);
 }
@@ -184,7 +490,18 @@ void IO::CircularBuffer<T, StorageType>::setCapacity(const qsizetype capacity)
 template<typename T, typename StorageType>
 qsizetype IO::CircularBuffer<T, StorageType>::size() const
 {
-  return m_size;
+  const auto tail = m_tail.load(std::memory_order_acquire);
+  const auto head = m_head.load(std::memory_order_acquire);
+  return static_cast<qsizetype>(tail - head);
+}
+
+/**
+ * @brief Returns the maximum number of elements that the buffer can hold.
+ */
+template<typename T, typename StorageType>
+qsizetype IO::CircularBuffer<T, StorageType>::capacity() const
+{
+  return m_capacity;
 }
 
 /**
@@ -195,7 +512,7 @@ qsizetype IO::CircularBuffer<T, StorageType>::size() const
 template<typename T, typename StorageType>
 qsizetype IO::CircularBuffer<T, StorageType>::freeSpace() const
 {
-  return m_capacity - m_size;
+  return m_capacity - size();
 }
 
 /**
@@ -211,21 +528,15 @@ qsizetype IO::CircularBuffer<T, StorageType>::freeSpace() const
 template<typename T, typename StorageType>
 T IO::CircularBuffer<T, StorageType>::read(qsizetype size)
 {
-  std::lock_guard<std::mutex> lock(m_mutex);
-
-  if (size > m_size)
+  if (size < 0 || size > this->size())
     throw std::underflow_error("Not enough data in buffer");
 
-  QByteArray result;
+  T result;
   result.resize(size);
 
-  for (qsizetype i = 0; i < size; ++i)
-  {
-    result[i] = m_buffer[m_head];
-    m_head = (m_head + 1) % m_capacity;
-  }
-
-  m_size -= size;
+  const auto head = m_head.load(std::memory_order_relaxed);
+  copyOut(head, size, reinterpret_cast<StorageType *>(result.data()));
+  m_head.store(head + size, std::memory_order_release);
 
   return result;
 }
@@ -245,23 +556,57 @@ T IO::CircularBuffer<T, StorageType>::read(qsizetype size)
 template<typename T, typename StorageType>
 T IO::CircularBuffer<T, StorageType>::peek(qsizetype size) const
 {
-  std::lock_guard<std::mutex> lock(m_mutex);
-
-  size = std::min(size, m_size);
+  size = std::max<qsizetype>(0, std::min(size, this->size()));
 
   T result;
   result.resize(size);
 
-  qsizetype firstChunk = std::min(size, m_capacity - m_head);
-  std::memcpy(result.data(), &m_buffer[m_head], firstChunk);
+  const auto head = m_head.load(std::memory_order_relaxed);
+  copyOut(head, size, reinterpret_cast<StorageType *>(result.data()));
 
-  if (size > firstChunk)
+  return result;
+}
+
+/**
+ * @brief Returns a read-only view of the buffered data without copying it.
+ *
+ * When the requested range is contiguous in memory, the returned object is
+ * created with `T::fromRawData()` and points directly into the ring. If the
+ * range wraps around the end of the ring, it is linearized once into an
+ * internal scratch buffer that is reused between calls.
+ *
+ * @param offset Logical offset (relative to the read position) of the view.
+ * @param size Number of elements in the view.
+ * @return A view over the requested data.
+ *
+ * @warning The returned object does not own its data. It is only valid until
+ *          the next call to `view()`, `skip()`, `read()` or `clear()`. Deep
+ *          copy it before handing it to another thread or storing it.
+ *
+ * @throws std::underflow_error if the range exceeds the buffered data.
+ */
+template<typename T, typename StorageType>
+T IO::CircularBuffer<T, StorageType>::view(qsizetype offset, qsizetype size)
+{
+  if (offset < 0 || size < 0 || offset + size > this->size())
+    throw std::underflow_error("Not enough data in buffer");
+
+  using ValueType = typename T::value_type;
+  const auto from = m_head.load(std::memory_order_relaxed) + offset;
+  const auto start = static_cast<qsizetype>(from % m_capacity);
+
+  // Range is contiguous, point straight into the ring
+  if (start + size <= m_capacity)
   {
-    size_t secondChunk = size - firstChunk;
-    std::memcpy(result.data() + firstChunk, &m_buffer[0], secondChunk);
+    const auto *ptr = m_buffer.data() + start;
+    return T::fromRawData(reinterpret_cast<const ValueType *>(ptr), size);
   }
 
-  return result;
+  // Range wraps around, linearize it into the scratch buffer
+  m_scratch.resize(size);
+  copyOut(from, size, m_scratch.data());
+  return T::fromRawData(reinterpret_cast<const ValueType *>(m_scratch.data()),
+                        size);
 }
 
 /**
@@ -273,6 +618,9 @@ T IO::CircularBuffer<T, StorageType>::peek(qsizetype size) const
  * the buffer is correctly handled to ensure accurate matching, even if the
  * pattern spans the end of the buffer and the beginning.
  *
+ * This overload builds a temporary scanner, so it rescans the buffer from
+ * @a pos on every call. Use the `KMPScanner` overload for repeated searches.
+ *
  * @tparam T The type of elements stored in the pattern and the buffer.
  * @tparam StorageType The type of storage used for the circular buffer.
  * @param pattern The pattern to search for in the buffer.
@@ -284,90 +632,252 @@ T IO::CircularBuffer<T, StorageType>::peek(qsizetype size) const
  *
  * @warning If the `pattern` is empty or its size exceeds the current size of
  *          the buffer, the function returns -1 immediately.
- *
- * @pre The buffer must be properly initialized, and the pattern should not
- *      exceed the capacity of the buffer.
  */
 template<typename T, typename StorageType>
 int IO::CircularBuffer<T, StorageType>::findPatternKMP(const T &pattern,
                                                        const int pos)
 {
-  std::lock_guard<std::mutex> lock(m_mutex);
+  KMPScanner<T> scanner(pattern);
+  return findPatternKMP(scanner, pos);
+}
 
+/**
+ * @brief Resumes a KMP search using the state stored in @a scanner.
+ *
+ * Only the bytes appended since the last call are examined. If a match that
+ * has not been consumed yet starts at or after @a pos, it is returned
+ * immediately without scanning.
+ *
+ * Since bytes before @a pos are never examined, @a pos must not move backwards
+ * between calls that share the same scanner (except through
+ * `KMPScanner::consume()`, which shifts all offsets consistently).
+ *
+ * @param scanner Search state, updated in place.
+ * @param pos Minimum start position (relative to the logical start of the
+ *            buffer) of the match.
+ *
+ * @return The index (relative to the logical start of the buffer) of the first
+ *         occurrence of the pattern at or after @a pos, or -1 if the pattern is
+ *         not found in the data received so far.
+ */
+template<typename T, typename StorageType>
+int IO::CircularBuffer<T, StorageType>::findPatternKMP(KMPScanner<T> &scanner,
+                                                       const int pos)
+{
   // Validate search pattern
-  if (pattern.isEmpty() || m_size < pattern.size())
+  const qsizetype m = scanner.pattern.size();
+  if (m == 0 || pos < 0)
     return -1;
 
-  // Start search at `pos`
-  std::vector<int> lps = computeKMPTable(pattern);
-  qsizetype bufferIdx = (m_head + pos) % m_capacity;
-  int i = pos, j = 0;
+  // Return a previously found match that was not consumed yet
+  if (scanner.found >= pos)
+    return static_cast<int>(scanner.found);
+
+  // Never match bytes located before `pos`
+  scanner.found = -1;
+  if (scanner.scanned < pos)
+  {
+    scanner.scanned = pos;
+    scanner.matched = 0;
+  }
 
-  while (i < m_size)
+  // Shorten partial matches that would start before `pos`
+  const auto &lps = scanner.lps;
+  qsizetype j = scanner.matched;
+  while (j > 0 && scanner.scanned - j < pos)
+    j = lps[j - 1];
+
+  // Resume the search where the last call left off
+  const qsizetype count = size();
+  const auto *p = reinterpret_cast<const StorageType *>(
+      scanner.pattern.constData());
+  const auto head = m_head.load(std::memory_order_relaxed);
+  qsizetype i = scanner.scanned;
+  auto index = static_cast<qsizetype>((head + i) % m_capacity);
+
+  // Scan each contiguous segment of the ring without per-byte modulo
+  while (i < count)
   {
-    // Compare current buffer character with the pattern
-    if (m_buffer[bufferIdx] == pattern[j])
+    const auto chunk = std::min(count - i, m_capacity - index);
+    const auto *data = m_buffer.data() + index;
+    for (qsizetype k = 0; k < chunk; ++k)
     {
-      i++;
-      j++;
-      bufferIdx = (bufferIdx + 1) % m_capacity;
+      // Mismatch after some matches, fall back in pattern
+      while (j > 0 && data[k] != p[j])
+        j = lps[j - 1];
 
-      // If the whole pattern is matched, return the logical start index
-      if (j == pattern.size())
+      // Whole pattern matched, store the match & return its start index
+      if (data[k] == p[j] && ++j == m)
       {
-        int matchStart = i - j;
-        return matchStart;
+        scanner.scanned = i + k + 1;
+        scanner.matched = lps[m - 1];
+        scanner.found = scanner.scanned - m;
+        return static_cast<int>(scanner.found);
       }
     }
 
-    // Mismatch after some matches, fall back in pattern
-    else if (j != 0)
-      j = lps[j - 1];
-
-    // Mismatch at the start, move forward
-    else
-    {
-      i++;
-      bufferIdx = (bufferIdx + 1) % m_capacity;
-    }
+    i += chunk;
+    index = 0;
   }
 
-  // Pattern not found
+  // Pattern not found, remember where to continue
+  scanner.scanned = i;
+  scanner.matched = j;
   return -1;
 }
 
 /**
- * @brief Computes the KMP table for a given p.
+ * @brief Finds the earliest delimiter in a single pass over the buffer.
+ *
+ * Candidate positions are located with `SIMD::findFirstOf()` over each
+ * contiguous segment of the ring, so wrap-around costs one extra call instead
+ * of a per-byte modulo. Only the bytes appended since the last call are
+ * examined; a delimiter that has not been consumed yet is returned immediately.
  *
- * Prepares the longest prefix suffix (LPS) table used by the KMP algorithm.
+ * If a pattern could still match at the end of the available data, the next
+ * call resumes at that position once more data arrives. An incomplete marker
+ * does not prevent a complete delimiter after it from being reported.
  *
- * @param p The QByteArray representing the p.
- * @return A vector of integers representing the LPS table.
+ * @param scanner Search state, updated in place. On success,
+ *                `scanner.delimiter` holds the index of the matched delimiter
+ *                and `scanner.markerAt` the first position of each marker
+ *                found before it.
+ *
+ * @return The index (relative to the logical start of the buffer) of the
+ *         earliest delimiter, or -1 if no delimiter was found yet.
  */
 template<typename T, typename StorageType>
-std::vector<int>
-IO::CircularBuffer<T, StorageType>::computeKMPTable(const T &p) const
+int IO::CircularBuffer<T, StorageType>::findDelimiter(
+    DelimiterScanner<T> &scanner)
 {
-  qsizetype m = p.size();
-  std::vector<int> lps(m, 0);
+  // Return a previously found delimiter that was not consumed yet
+  if (scanner.found >= 0)
+    return static_cast<int>(scanner.found);
 
-  qsizetype len = 0;
-  qsizetype i = 1;
+  // Nothing to search for
+  if (scanner.firstBytes.empty())
+    return -1;
 
-  while (i < m)
+  // Resume the search where the last call left off
+  const qsizetype count = size();
+  const auto head = m_head.load(std::memory_order_relaxed);
+  qsizetype i = scanner.scanned;
+  qsizetype resume = -1;
+  while (i < count)
   {
-    if (p[i] == p[len])
+    // Find the next candidate byte in the current contiguous segment
+    const auto index = static_cast<qsizetype>((head + i) % m_capacity);
+    const auto chunk = std::min(count - i, m_capacity - index);
+    const auto offset = SIMD::findFirstOf(
+        reinterpret_cast<const char *>(m_buffer.data() + index), chunk,
+        scanner.firstBytes.data(), scanner.firstBytes.size());
+
+    // No candidates in this segment, move to the next one
+    if (offset < 0)
     {
-      len++;
-      lps[i++] = len;
+      i += chunk;
+      continue;
     }
 
-    else if (len != 0)
-      len = lps[len - 1];
+    // Check the full patterns at the candidate position
+    i += offset;
+    bool pending = false;
+    qsizetype longest = 0;
+    const auto from = head + i;
+    const auto available = count - i;
+    for (int k = 0; k < scanner.markers.size(); ++k)
+    {
+      const auto result = compareAt(from, available, scanner.markers[k]);
+      if (result > 0 && scanner.markerAt[k] < 0)
+        scanner.markerAt[k] = i;
+      else if (result < 0 && resume < 0)
+        resume = i;
+    }
 
-    else
-      lps[i++] = 0;
+    for (int k = 0; k < scanner.delimiters.size(); ++k)
+    {
+      const auto &pattern = scanner.delimiters[k];
+      const auto result = compareAt(from, available, pattern);
+      if (result > 0 && pattern.size() > longest)
+      {
+        longest = pattern.size();
+        scanner.delimiter = k;
+      }
+
+      else if (result < 0)
+        pending = true;
+    }
+
+    // Delimiter found, store the match & return its start index
+    if (longest > 0)
+    {
+      scanner.found = i;
+      scanner.scanned = i + 1;
+      return static_cast<int>(i);
+    }
+
+    // A delimiter may still match once more data arrives
+    if (pending)
+      break;
+
+    ++i;
+  }
+
+  // No delimiter found, resume at the first incomplete match (if any)
+  scanner.scanned = std::min(i, count);
+  if (resume >= 0)
+    scanner.scanned = std::min(scanner.scanned, resume);
+
+  return -1;
+}
+
+/**
+ * @brief Compares the data at a ring position against a pattern.
+ *
+ * @param from Absolute (monotonic) position of the first byte to compare.
+ * @param available Number of bytes available from @a from onwards.
+ * @param pattern The pattern to compare against.
+ *
+ * @return 1 if the pattern matches, 0 if it does not, or -1 if the available
+ *         data is a prefix of the pattern (i.e. more data is needed).
+ */
+template<typename T, typename StorageType>
+int IO::CircularBuffer<T, StorageType>::compareAt(quint64 from,
+                                                  qsizetype available,
+                                                  const T &pattern) const
+{
+  if (pattern.isEmpty())
+    return 0;
+
+  const auto *p = reinterpret_cast<const StorageType *>(pattern.constData());
+  const auto length = std::min<qsizetype>(available, pattern.size());
+  for (qsizetype j = 0; j < length; ++j)
+  {
+    if (m_buffer[(from + j) % m_capacity] != p[j])
+      return 0;
   }
 
-  return lps;
+  return length < pattern.size() ? -1 : 1;
+}
+
+/**
+ * @brief Copies a range of the ring into linear memory.
+ *
+ * @param from Absolute (monotonic) position of the first element to copy.
+ * @param size Number of elements to copy.
+ * @param dst Destination pointer, must hold at least @a size elements.
+ */
+template<typename T, typename StorageType>
+void IO::CircularBuffer<T, StorageType>::copyOut(quint64 from, qsizetype size,
+                                                 StorageType *dst) const
+{
+  if (size <= 0)
+    return;
+
+  const auto start = static_cast<qsizetype>(from % m_capacity);
+  const auto firstChunk = std::min(size, m_capacity - start);
+  std::memcpy(dst, m_buffer.data() + start, firstChunk * sizeof(StorageType));
+  if (size > firstChunk)
+    std::memcpy(dst + firstChunk, m_buffer.data(),
+                (size - firstChunk) * sizeof(StorageType));
 }
@@ -140,6 +140,8 @@ public:
   Q_INVOKABLE QString formatUserHex(const QString &text);
 
   static QByteArray hexToBytes(const QString &data);
+  static QString plainTextStr(const QByteArray &data);
+  static QString hexadecimalStr(const QByteArray &data);
 
 public slots:
   void clear();
@@ -162,8 +164,6 @@ private slots:
 
 private:
   QString dataToString(const QByteArray &data);
-  QString plainTextStr(const QByteArray &data);
-  QString hexadecimalStr(const QByteArray &data);
 
 private:
   DataMode m_dataMode;
@@ -23,6 +23,122 @@
 #include "IO/Drivers/Network.h"
 
 #include "Misc/Utilities.h"
+#include "Misc/TimerEvents.h"
+
+#ifdef Q_OS_LINUX
+#  include <cstring>
+#  include <sys/socket.h>
+#endif
+
+namespace
+{
+/**
+ * @brief Maximum number of datagrams read with a single system call.
+ */
+constexpr int kDatagramBatchSize = 64;
+
+/**
+ * @brief Maximum number of batched reads per notification, so that a flood of
+ *        datagrams cannot starve the rest of the I/O thread's event loop.
+ */
+constexpr int kMaxBatchedReads = 16;
+
+/**
+ * @brief Maximum number of bytes published in a single datagram batch, well
+ *        below the capacity of the frame reader's circular buffer.
+ */
+constexpr qsizetype kMaxBatchBytes = 256 * 1024;
+
+#ifdef Q_OS_LINUX
+/**
+ * @brief Size of each slot of the datagram slab, large enough for any UDP
+ *        payload, so that datagrams are never truncated.
+ */
+constexpr int kDatagramSlotSize = 64 * 1024;
+
+/**
+ * @brief Size of the ancillary data buffer of each datagram slot, which
+ *        receives the socket's drop counter (`SO_RXQ_OVFL`).
+ */
+constexpr int kControlSlotSize = CMSG_SPACE(sizeof(quint32));
+
+/**
+ * @brief Reads all pending datagrams of socket @a fd with `recvmmsg()`.
+ *
+ * Datagrams are received in groups of up to `kDatagramBatchSize` into the
+ * preallocated @a slab, and then appended to @a batch. Whenever the batch
+ * reaches `kMaxBatchBytes`, it is handed over to @a publish and cleared.
+ *
+ * @param fd The socket descriptor.
+ * @param slab Buffer with `kDatagramBatchSize` slots of `kDatagramSlotSize`.
+ * @param control Buffer with `kDatagramBatchSize` slots of `kControlSlotSize`.
+ * @param batch Receives the datagrams.
+ * @param drops Receives the latest value of the kernel drop counter.
+ * @param publish Called with each full batch.
+ */
+template<typename Function>
+void receiveDatagrams(const int fd, char *slab, char *control,
+                      IO::DatagramBatch &batch, std::atomic<quint64> &drops,
+                      Function &&publish)
+{
+  // Point each message to its slab & control slots
+  iovec iov[kDatagramBatchSize];
+  mmsghdr messages[kDatagramBatchSize];
+  std::memset(messages, 0, sizeof(messages));
+  for (int i = 0; i < kDatagramBatchSize; ++i)
+  {
+    iov[i].iov_base = slab + i * kDatagramSlotSize;
+    iov[i].iov_len = kDatagramSlotSize;
+    messages[i].msg_hdr.msg_iov = &iov[i];
+    messages[i].msg_hdr.msg_iovlen = 1;
+    messages[i].msg_hdr.msg_control = control + i * kControlSlotSize;
+    messages[i].msg_hdr.msg_controllen = kControlSlotSize;
+  }
+
+  // Drain the socket without blocking
+  for (int read = 0; read < kMaxBatchedReads; ++read)
+  {
+    const int count
+        = ::recvmmsg(fd, messages, kDatagramBatchSize, MSG_DONTWAIT, nullptr);
+    if (count <= 0)
+      break;
+
+    for (int i = 0; i < count; ++i)
+    {
+      // Copy the datagram out of the slab
+      auto &header = messages[i].msg_hdr;
+      const auto size = static_cast<int>(messages[i].msg_len);
+      batch.data.append(slab + i * kDatagramSlotSize, size);
+      batch.sizes.append(size);
+      if (batch.data.size() >= kMaxBatchBytes)
+      {
+        publish(batch);
+        batch = IO::DatagramBatch();
+      }
+
+      // Obtain the number of datagrams dropped by the kernel
+      for (auto *c = CMSG_FIRSTHDR(&header); c; c = CMSG_NXTHDR(&header, c))
+      {
+        if (c->cmsg_level == SOL_SOCKET && c->cmsg_type == SO_RXQ_OVFL)
+        {
+          quint32 value;
+          std::memcpy(&value, CMSG_DATA(c), sizeof(value));
+          drops.store(value, std::memory_order_relaxed);
+        }
+      }
+
+      // The kernel updates these fields, restore them for the next call
+      header.msg_flags = 0;
+      header.msg_controllen = kControlSlotSize;
+    }
+
+    // The socket is empty
+    if (count < kDatagramBatchSize)
+      break;
+  }
+}
+#endif
+} // namespace
 
 //------------------------------------------------------------------------------
 // Constructor & singleton access functions
@@ -35,6 +151,8 @@ IO::Drivers::Network::Network()
   : m_hostExists(false)
   , m_udpMulticast(false)
   , m_lookupActive(false)
+  , m_udpReceiveBufferSize(0)
+  , m_udpKernelDrops(0)
 {
   // Set initial configuration
   setRemoteAddress("");
@@ -51,12 +169,25 @@ IO::Drivers::Network::Network()
   connect(this, &IO::Drivers::Network::portChanged, this,
           &IO::Drivers::Network::configurationChanged);
 
+  // Refresh the kernel drop counter of the UDP socket
+  connect(&Misc::TimerEvents::instance(), &Misc::TimerEvents::timeout1Hz, this,
+          [=] {
+            if (socketType() == QAbstractSocket::UdpSocket)
+              Q_EMIT udpKernelDropsChanged();
+          });
+
   // Update open state when socket states change
   connect(&m_tcpSocket, &QUdpSocket::stateChanged, this,
           [=] { Q_EMIT configurationChanged(); });
   connect(&m_udpSocket, &QUdpSocket::stateChanged, this,
           [=] { Q_EMIT configurationChanged(); });
 
+  // Record the open state in the thread of each socket
+  connect(&m_tcpSocket, &QTcpSocket::stateChanged, &m_tcpSocket,
+          [=] { updateSocketState(&m_tcpSocket); });
+  connect(&m_udpSocket, &QUdpSocket::stateChanged, &m_udpSocket,
+          [=] { updateSocketState(&m_udpSocket); });
+
   // Report socket errors
 #if QT_VERSION < QT_VERSION_CHECK(5, 12, 0)
   connect(&m_tcpSocket, SIGNAL(error(QAbstractSocket::SocketError)), this,
@@ -72,7 +203,8 @@ IO::Drivers::Network::Network()
 }
 
 /**
- * Returns the only instance of this class
+ * Returns the instance of this class used for the main device, additional
+ * data sources create their own instances.
  */
 IO::Drivers::Network &IO::Drivers::Network::instance()
 {
@@ -87,47 +219,41 @@ IO::Drivers::Network &IO::Drivers::Network::instance()
 /**
  * Closes the current network connection and discards signals/slots with the
  * TCP/UDP socket in use by the network module.
+ *
+ * The sockets are handed back to the thread of the driver, so that they can be
+ * safely destroyed together with it.
  */
 void IO::Drivers::Network::close()
 {
-  // Abort network connections
-  m_tcpSocket.abort();
-  m_udpSocket.abort();
-  m_tcpSocket.disconnectFromHost();
-  m_udpSocket.disconnectFromHost();
-
   // Disconnect signals/slots
-  if (socketType() == QAbstractSocket::TcpSocket)
-    disconnect(&m_tcpSocket, &QTcpSocket::readyRead, this,
-               &IO::Drivers::Network::onReadyRead);
-  else if (socketType() == QAbstractSocket::UdpSocket)
-    disconnect(&m_udpSocket, &QUdpSocket::readyRead, this,
-               &IO::Drivers::Network::onReadyRead);
+  disconnect(&m_tcpSocket, &QTcpSocket::readyRead, nullptr, nullptr);
+  disconnect(&m_udpSocket, &QUdpSocket::readyRead, nullptr, nullptr);
+
+  // Abort network connections in the I/O thread
+  invokeOnDevice(&m_tcpSocket, [=] {
+    m_tcpSocket.abort();
+    m_udpSocket.abort();
+    m_tcpSocket.disconnectFromHost();
+    m_udpSocket.disconnectFromHost();
+    setDeviceState(nullptr);
+
+    // Hand the sockets back to the thread of the driver
+    if (QThread::currentThread() == m_tcpSocket.thread()
+        && m_tcpSocket.thread() != thread())
+    {
+      m_tcpSocket.moveToThread(thread());
+      m_udpSocket.moveToThread(thread());
+    }
+  });
 }
 
 /**
- * Returns @c true if a network connection is currently open
+ * Returns @c true if the socket is open and connected (TCP) or bound (UDP),
+ * may be called from any thread.
  */
 bool IO::Drivers::Network::isOpen() const
 {
-  bool open = false;
-  auto state = QAbstractSocket::UnconnectedState;
-
-  if (socketType() == QAbstractSocket::UdpSocket)
-  {
-    open = m_udpSocket.isOpen();
-    state = m_udpSocket.state();
-  }
-
-  else if (socketType() == QAbstractSocket::TcpSocket)
-  {
-    open = m_tcpSocket.isOpen();
-    state = m_tcpSocket.state();
-  }
-
-  return open
-         && (state == QUdpSocket::ConnectedState
-             || state == QUdpSocket::BoundState);
+  return deviceOpen();
 }
 
 /**
@@ -135,12 +261,7 @@ bool IO::Drivers::Network::isOpen() const
  */
 bool IO::Drivers::Network::isReadable() const
 {
-  if (socketType() == QAbstractSocket::UdpSocket)
-    return m_udpSocket.isReadable();
-  else if (socketType() == QAbstractSocket::TcpSocket)
-    return m_tcpSocket.isReadable();
-
-  return false;
+  return deviceReadable();
 }
 
 /**
@@ -148,12 +269,7 @@ bool IO::Drivers::Network::isReadable() const
  */
 bool IO::Drivers::Network::isWritable() const
 {
-  if (socketType() == QAbstractSocket::UdpSocket)
-    return m_udpSocket.isWritable();
-  else if (socketType() == QAbstractSocket::TcpSocket)
-    return m_tcpSocket.isWritable();
-
-  return false;
+  return deviceWritable();
 }
 
 /**
@@ -175,12 +291,20 @@ bool IO::Drivers::Network::configurationOk() const
  */
 quint64 IO::Drivers::Network::write(const QByteArray &data)
 {
-  if (isWritable())
+  QIODevice *socket = nullptr;
+  if (socketType() == QAbstractSocket::UdpSocket)
+    socket = &m_udpSocket;
+  else if (socketType() == QAbstractSocket::TcpSocket)
+    socket = &m_tcpSocket;
+
+  if (socket)
   {
-    if (socketType() == QAbstractSocket::UdpSocket)
-      return m_udpSocket.write(data);
-    else if (socketType() == QAbstractSocket::TcpSocket)
-      return m_tcpSocket.write(data);
+    return invokeOnDevice(socket, [=]() -> quint64 {
+      if (socket->isWritable())
+        return socket->write(data);
+
+      return -1;
+    });
   }
 
   return -1;
@@ -193,6 +317,9 @@ quint64 IO::Drivers::Network::write(const QByteArray &data)
  * type (TCP or UDP). For TCP, it connects to the remote host, while for UDP,
  * it binds to the specified local port and joins a multicast group if required.
  *
+ * Both sockets are moved to the I/O thread the first time a connection is
+ * opened, so that incoming data is read outside of the GUI thread.
+ *
  * @param mode The mode in which to open the network connection.
  * @return `true` if the connection is successfully opened, `false` otherwise.
  */
@@ -206,41 +333,69 @@ bool IO::Drivers::Network::open(const QIODevice::OpenMode mode)
   if (hostAddr.isEmpty())
     hostAddr = defaultAddress();
 
+  // Move sockets to the I/O thread
+  if (m_tcpSocket.thread() != ioThread())
+  {
+    m_tcpSocket.moveToThread(ioThread());
+    m_udpSocket.moveToThread(ioThread());
+  }
+
   // Init socket pointer
   QIODevice *socket = nullptr;
-
-  // TCP connection, assign socket pointer & connect to host
   if (socketType() == QAbstractSocket::TcpSocket)
-  {
     socket = static_cast<QIODevice *>(&m_tcpSocket);
-    m_tcpSocket.connectToHost(hostAddr, tcpPort());
-  }
-
-  // UDP connection, assign socket pointer & bind to host
   else if (socketType() == QAbstractSocket::UdpSocket)
-  {
-    // Bind the UDP socket
-    m_udpSocket.bind(udpLocalPort(), QAbstractSocket::ShareAddress
-                                         | QAbstractSocket::ReuseAddressHint);
-
-    // Join the multicast group (if required)
-    if (udpMulticast())
-      m_udpSocket.joinMulticastGroup(
-          QHostAddress(QHostAddress(m_address).toIPv6Address()));
-
-    // Set socket pointer
     socket = static_cast<QIODevice *>(&m_udpSocket);
-  }
 
-  // Open network socket
+  // Connect/bind & open network socket in the I/O thread
   if (socket)
   {
-    if (socket->open(mode))
-    {
-      connect(socket, &QIODevice::readyRead, this,
-              &IO::Drivers::Network::onReadyRead);
+    // Read incoming data directly in the I/O thread
+    connect(socket, &QIODevice::readyRead, socket, [=] { onReadyRead(); });
+
+    // Connect to the host or bind the socket
+    const bool opened = invokeOnDevice(socket, [&] {
+      // TCP connection, connect to host
+      if (socket == &m_tcpSocket)
+        m_tcpSocket.connectToHost(hostAddr, tcpPort());
+
+      // UDP connection, bind to host
+      else
+      {
+        // Bind the UDP socket
+        m_udpSocket.bind(udpLocalPort(),
+                         QAbstractSocket::ShareAddress
+                             | QAbstractSocket::ReuseAddressHint);
+
+        // Join the multicast group (if required)
+        if (udpMulticast())
+          m_udpSocket.joinMulticastGroup(
+              QHostAddress(QHostAddress(m_address).toIPv6Address()));
+
+        // Enlarge the kernel receive buffer (if required)
+        if (m_udpReceiveBufferSize > 0)
+          m_udpSocket.setSocketOption(
+              QAbstractSocket::ReceiveBufferSizeSocketOption,
+              m_udpReceiveBufferSize * 1024);
+
+        // Ask the kernel to report the number of dropped datagrams
+        m_udpKernelDrops.store(0, std::memory_order_relaxed);
+#ifdef Q_OS_LINUX
+        const int enable = 1;
+        const auto fd = static_cast<int>(m_udpSocket.socketDescriptor());
+        if (fd >= 0)
+          ::setsockopt(fd, SOL_SOCKET, SO_RXQ_OVFL, &enable, sizeof(enable));
+#endif
+      }
+
+      const bool ok = socket->open(mode);
+      updateSocketState(static_cast<QAbstractSocket *>(socket));
+      return ok;
+    });
+
+    // Connection successful
+    if (opened)
       return true;
-    }
   }
 
   // Open failure, abort connection
@@ -252,6 +407,17 @@ bool IO::Drivers::Network::open(const QIODevice::OpenMode mode)
 // Driver specifics
 //------------------------------------------------------------------------------
 
+/**
+ * Records the open state of the given @a socket, which counts as open once it
+ * is connected (TCP) or bound (UDP). Called from the thread of the socket.
+ */
+void IO::Drivers::Network::updateSocketState(const QAbstractSocket *socket)
+{
+  const auto state = socket->state();
+  setDeviceState(socket, state == QAbstractSocket::ConnectedState
+                             || state == QAbstractSocket::BoundState);
+}
+
 /**
  * Returns the TCP port number
  */
@@ -285,6 +451,42 @@ bool IO::Drivers::Network::udpMulticast() const
   return m_udpMulticast;
 }
 
+/**
+ * Returns the number of datagrams that the kernel discarded because the
+ * receive buffer of the UDP socket was full, since the socket was opened.
+ *
+ * The kernel reports the counter along with received datagrams, so drops are
+ * only visible once the next datagram is read.
+ *
+ * @note Only available on Linux, always zero on other platforms.
+ */
+quint64 IO::Drivers::Network::udpKernelDrops() const
+{
+  return m_udpKernelDrops.load(std::memory_order_relaxed);
+}
+
+/**
+ * Returns the requested kernel receive buffer size of the UDP socket in KB,
+ * zero if the operating system default is used.
+ */
+int IO::Drivers::Network::udpReceiveBufferSize() const
+{
+  return m_udpReceiveBufferSize;
+}
+
+/**
+ * Returns @c true if the operating system reports the number of datagrams
+ * dropped by the UDP socket.
+ */
+bool IO::Drivers::Network::udpKernelDropsAvailable() const
+{
+#ifdef Q_OS_LINUX
+  return true;
+#else
+  return false;
+#endif
+}
+
 /**
  * Returns @c true if we are currently performing a DNS lookup
  */
@@ -429,6 +631,19 @@ void IO::Drivers::Network::setUdpMulticast(const bool enabled)
   Q_EMIT udpMulticastChanged();
 }
 
+/**
+ * Changes the kernel receive buffer size (`SO_RCVBUF`) requested for the UDP
+ * socket, in KB. A larger buffer absorbs longer bursts of datagrams while the
+ * application is busy. Zero keeps the operating system default. The value is
+ * applied when the socket is opened, and may be capped by the system (e.g.
+ * by @c net.core.rmem_max on Linux).
+ */
+void IO::Drivers::Network::setUdpReceiveBufferSize(const int kilobytes)
+{
+  m_udpReceiveBufferSize = qBound(0, kilobytes, 512 * 1024);
+  Q_EMIT udpReceiveBufferSizeChanged();
+}
+
 /**
  * Changes the current socket type given an index of the list returned by the
  * @c socketType() function.
@@ -462,25 +677,91 @@ void IO::Drivers::Network::setSocketType(const QAbstractSocket::SocketType type)
 }
 
 /**
- * Reads incoming data from the UDP/TCP ports
+ * Reads incoming data from the UDP/TCP ports, runs in the I/O thread.
  */
 void IO::Drivers::Network::onReadyRead()
 {
   // Check if we need to use UDP socket functions
   if (socketType() == QAbstractSocket::UdpSocket)
+    readDatagrams();
+
+  // We are using the TCP socket...
+  else if (socketType() == QAbstractSocket::TcpSocket)
+    processData(tcpSocket()->readAll());
+}
+
+/**
+ * Reads all pending UDP datagrams and publishes them as a single batch.
+ *
+ * The first datagram is always read through Qt, which re-enables the socket
+ * notifier of the UDP socket. On Linux, the remaining datagrams are drained
+ * with `recvmmsg()` into a preallocated slab, which needs one system call for
+ * up to 64 datagrams and also reports the kernel drop counter.
+ *
+ * Large bursts are published in several batches of about `kMaxBatchBytes`,
+ * so that a single batch always fits in the frame reader's buffer.
+ */
+void IO::Drivers::Network::readDatagrams()
+{
+  DatagramBatch batch;
+
+  // Read the datagram that triggered the notification
+  if (m_udpSocket.hasPendingDatagrams())
   {
-    while (udpSocket()->hasPendingDatagrams())
+    const auto size = qMax<qint64>(0, m_udpSocket.pendingDatagramSize());
+    batch.data.resize(size);
+    const auto read = m_udpSocket.readDatagram(batch.data.data(), size);
+    batch.data.resize(qMax<qint64>(0, read));
+    if (read >= 0)
+      batch.sizes.append(static_cast<int>(read));
+  }
+
+  // Drain the socket in batches
+#ifdef Q_OS_LINUX
+  const auto fd = static_cast<int>(m_udpSocket.socketDescriptor());
+  if (fd >= 0)
+  {
+    if (m_datagramSlab.isEmpty())
     {
-      QByteArray datagram;
-      datagram.resize(int(udpSocket()->pendingDatagramSize()));
-      udpSocket()->readDatagram(datagram.data(), datagram.size());
-      processData(datagram);
+      m_datagramSlab = QByteArray(kDatagramBatchSize * kDatagramSlotSize,
+                                  Qt::Uninitialized);
+      m_controlSlab = QByteArray(kDatagramBatchSize * kControlSlotSize,
+                                 Qt::Uninitialized);
     }
+
+    receiveDatagrams(fd, m_datagramSlab.data(), m_controlSlab.data(), batch,
+                     m_udpKernelDrops, [=](const DatagramBatch &full) {
+                       processDatagrams(full);
+                     });
   }
 
-  // We are using the TCP socket...
-  else if (socketType() == QAbstractSocket::TcpSocket)
-    processData(tcpSocket()->readAll());
+  // Use the portable Qt API on other platforms
+#else
+  for (int i = 1; i < kDatagramBatchSize * kMaxBatchedReads; ++i)
+  {
+    const auto size = m_udpSocket.pendingDatagramSize();
+    if (size < 0)
+      break;
+
+    const auto offset = batch.data.size();
+    batch.data.resize(offset + size);
+    auto *buffer = batch.data.data() + offset;
+    const auto read = m_udpSocket.readDatagram(buffer, size);
+    batch.data.resize(offset + qMax<qint64>(0, read));
+    if (read >= 0)
+      batch.sizes.append(static_cast<int>(read));
+
+    if (batch.data.size() >= kMaxBatchBytes)
+    {
+      processDatagrams(batch);
+      batch = DatagramBatch();
+    }
+  }
+#endif
+
+  // Publish the datagrams
+  if (!batch.isEmpty())
+    processDatagrams(batch);
 }
 
 /**
@@ -515,9 +796,11 @@ void IO::Drivers::Network::onErrorOccurred(
 {
   QString error;
   if (socketType() == QAbstractSocket::TcpSocket)
-    error = m_tcpSocket.errorString();
+    error = invokeOnDevice(&m_tcpSocket,
+                           [=] { return m_tcpSocket.errorString(); });
   else if (socketType() == QAbstractSocket::UdpSocket)
-    error = m_udpSocket.errorString();
+    error = invokeOnDevice(&m_udpSocket,
+                           [=] { return m_udpSocket.errorString(); });
   else
     error = QString::number(socketError);
 
@@ -28,6 +28,8 @@
 #include <QHostAddress>
 #include <QAbstractSocket>
 
+#include <atomic>
+
 #include "IO/HAL_Driver.h"
 
 namespace IO
@@ -89,6 +91,16 @@ class Network : public HAL_Driver
              READ udpMulticast
              WRITE setUdpMulticast
              NOTIFY udpMulticastChanged)
+  Q_PROPERTY(int udpReceiveBufferSize
+             READ udpReceiveBufferSize
+             WRITE setUdpReceiveBufferSize
+             NOTIFY udpReceiveBufferSizeChanged)
+  Q_PROPERTY(quint64 udpKernelDrops
+             READ udpKernelDrops
+             NOTIFY udpKernelDropsChanged)
+  Q_PROPERTY(bool udpKernelDropsAvailable
+             READ udpKernelDropsAvailable
+             CONSTANT)
   // clang-format on
 
 signals:
@@ -96,16 +108,18 @@ signals:
   void addressChanged();
   void socketTypeChanged();
   void udpMulticastChanged();
+  void udpKernelDropsChanged();
+  void udpReceiveBufferSizeChanged();
   void lookupActiveChanged();
 
 private:
-  explicit Network();
   Network(Network &&) = delete;
   Network(const Network &) = delete;
   Network &operator=(Network &&) = delete;
   Network &operator=(const Network &) = delete;
 
 public:
+  explicit Network();
   static Network &instance();
 
   void close() override;
@@ -122,6 +136,9 @@ public:
   [[nodiscard]] quint16 udpRemotePort() const;
 
   [[nodiscard]] bool udpMulticast() const;
+  [[nodiscard]] quint64 udpKernelDrops() const;
+  [[nodiscard]] int udpReceiveBufferSize() const;
+  [[nodiscard]] bool udpKernelDropsAvailable() const;
   [[nodiscard]] bool lookupActive() const;
   [[nodiscard]] int socketTypeIndex() const;
   [[nodiscard]] QAbstractSocket::SocketType socketType() const;
@@ -148,6 +165,7 @@ public slots:
   void setTcpPort(const quint16 port);
   void setUdpLocalPort(const quint16 port);
   void setUdpMulticast(const bool enabled);
+  void setUdpReceiveBufferSize(const int kilobytes);
   void setSocketTypeIndex(const int index);
   void setUdpRemotePort(const quint16 port);
   void setRemoteAddress(const QString &address);
@@ -158,6 +176,10 @@ private slots:
   void lookupFinished(const QHostInfo &info);
   void onErrorOccurred(const QAbstractSocket::SocketError socketError);
 
+private:
+  void readDatagrams();
+  void updateSocketState(const QAbstractSocket *socket);
+
 private:
   QString m_address;
   quint16 m_tcpPort;
@@ -168,6 +190,11 @@ private:
   quint16 m_udpRemotePort;
   QAbstractSocket::SocketType m_socketType;
 
+  int m_udpReceiveBufferSize;
+  std::atomic<quint64> m_udpKernelDrops;
+  QByteArray m_datagramSlab;
+  QByteArray m_controlSlab;
+
   QTcpSocket m_tcpSocket;
   QUdpSocket m_udpSocket;
 };
@@ -0,0 +1,420 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "IO/Drivers/Replay.h"
+
+#include <QFileInfo>
+#include <QFileDialog>
+#include <QStandardPaths>
+
+#include "Misc/Utilities.h"
+
+namespace
+{
+/**
+ * @brief Largest amount of data emitted at once, so that replaying a capture
+ *        as fast as possible does not produce huge batches.
+ */
+constexpr qint64 kMaxBatchSize = 64 * 1024;
+
+/**
+ * @brief Largest amount of data that may be emitted before the frame reader
+ *        takes it, well below the size of the frame reader's buffer.
+ */
+constexpr qint64 kMaxInFlight = 256 * 1024;
+
+/**
+ * @brief Longest timer interval, so that long pauses in the capture are
+ *        waited in several steps.
+ */
+constexpr qint64 kMaxInterval = 1000;
+} // namespace
+
+//------------------------------------------------------------------------------
+// Constructor & singleton access functions
+//------------------------------------------------------------------------------
+
+/**
+ * Constructor function
+ */
+IO::Drivers::Replay::Replay()
+  : m_speed(1)
+  , m_asFastAsPossible(false)
+  , m_open(false)
+  , m_stalled(false)
+  , m_finished(false)
+  , m_inFlight(0)
+  , m_playbackSpeed(1)
+  , m_playbackAsFast(false)
+  , m_startTime(0)
+  , m_firstTimestamp(0)
+  , m_pending(false)
+{
+  // Replay the records that are due every time the timer expires
+  m_timer.setSingleShot(true);
+  m_timer.setTimerType(Qt::PreciseTimer);
+  connect(&m_timer, &QTimer::timeout, &m_timer, [=] { playback(); });
+
+  // Update connect button status when the file is changed
+  connect(this, &IO::Drivers::Replay::filePathChanged, this,
+          &IO::Drivers::Replay::configurationChanged);
+}
+
+/**
+ * Returns the only instance of the class
+ */
+IO::Drivers::Replay &IO::Drivers::Replay::instance()
+{
+  static Replay singleton;
+  return singleton;
+}
+
+//------------------------------------------------------------------------------
+// HAL driver implementation
+//------------------------------------------------------------------------------
+
+/**
+ * Stops the playback and closes the capture file.
+ *
+ * The playback timer is handed back to the thread of the driver, so that it
+ * can be safely destroyed together with it.
+ */
+void IO::Drivers::Replay::close()
+{
+  m_open = false;
+  m_stalled = false;
+
+  invokeOnDevice(&m_timer, [=] {
+    m_timer.stop();
+    m_reader.close();
+    m_pending = false;
+
+    if (QThread::currentThread() == m_timer.thread()
+        && m_timer.thread() != thread())
+      m_timer.moveToThread(thread());
+  });
+}
+
+/**
+ * Returns @c true if a capture is being replayed.
+ */
+bool IO::Drivers::Replay::isOpen() const
+{
+  return m_open;
+}
+
+/**
+ * Returns @c true if a capture is being replayed.
+ */
+bool IO::Drivers::Replay::isReadable() const
+{
+  return isOpen();
+}
+
+/**
+ * Returns @c false, captures are read-only.
+ */
+bool IO::Drivers::Replay::isWritable() const
+{
+  return false;
+}
+
+/**
+ * Returns @c true if the selected capture file exists.
+ */
+bool IO::Drivers::Replay::configurationOk() const
+{
+  return !m_filePath.isEmpty() && QFileInfo::exists(m_filePath);
+}
+
+/**
+ * @brief Discards @a data, captures are read-only.
+ *
+ * @return Always 0, no data is written.
+ */
+quint64 IO::Drivers::Replay::write(const QByteArray &data)
+{
+  (void)data;
+  return 0;
+}
+
+/**
+ * @brief Opens the selected capture and starts replaying it.
+ *
+ * The playback settings are applied when the capture is opened. The @a mode
+ * is ignored, since data cannot be written to a capture.
+ *
+ * @return @c true if the capture file was opened.
+ */
+bool IO::Drivers::Replay::open(const QIODevice::OpenMode mode)
+{
+  (void)mode;
+
+  // Stop the current playback
+  close();
+
+  // Map the capture file
+  if (!m_reader.open(m_filePath))
+  {
+    Misc::Utilities::showMessageBox(tr("Cannot open capture file"),
+                                    m_reader.errorString(),
+                                    QMessageBox::Critical);
+    return false;
+  }
+
+  // Reset the end of capture flag
+  if (m_finished.exchange(false))
+    Q_EMIT finishedChanged();
+
+  // Move the playback timer to the I/O thread
+  if (m_timer.thread() != ioThread())
+    m_timer.moveToThread(ioThread());
+
+  // Start the playback in the I/O thread
+  m_playbackSpeed = m_speed;
+  m_playbackAsFast = m_asFastAsPossible;
+  m_open = true;
+  invokeOnDevice(&m_timer, [=] { start(); });
+  return true;
+}
+
+//------------------------------------------------------------------------------
+// Driver specifics
+//------------------------------------------------------------------------------
+
+/**
+ * Returns the playback speed multiplier, 1 replays the capture in real time.
+ */
+double IO::Drivers::Replay::speed() const
+{
+  return m_speed;
+}
+
+/**
+ * Returns @c true once all the records of the capture have been replayed.
+ */
+bool IO::Drivers::Replay::finished() const
+{
+  return m_finished;
+}
+
+/**
+ * Returns the number of bytes that were emitted by the driver, but whose
+ * frames were not extracted by the frame reader yet (see `acknowledge()`).
+ *
+ * @note This function is thread-safe.
+ */
+qint64 IO::Drivers::Replay::pendingBytes() const
+{
+  return qMax<qint64>(0, m_inFlight.load());
+}
+
+/**
+ * Returns the name of the selected capture file, without its directory.
+ */
+QString IO::Drivers::Replay::fileName() const
+{
+  if (m_filePath.isEmpty())
+    return tr("No file selected...");
+
+  return QFileInfo(m_filePath).fileName();
+}
+
+/**
+ * Returns @c true if the timestamps of the capture are ignored, and records
+ * are replayed as fast as the frame reader consumes them.
+ */
+bool IO::Drivers::Replay::asFastAsPossible() const
+{
+  return m_asFastAsPossible;
+}
+
+/**
+ * Returns the path of the selected capture file.
+ */
+const QString &IO::Drivers::Replay::filePath() const
+{
+  return m_filePath;
+}
+
+/**
+ * @brief Notifies the driver that the frame reader extracted the frames of
+ *        @a bytes of the data emitted by the driver.
+ *
+ * May be called from any thread. Resumes a playback that was waiting for the
+ * frame reader to catch up.
+ */
+void IO::Drivers::Replay::acknowledge(const qsizetype bytes)
+{
+  m_inFlight.fetch_sub(bytes);
+  if (m_stalled.exchange(false))
+    QMetaObject::invokeMethod(
+        &m_timer, [=] { playback(); }, Qt::QueuedConnection);
+}
+
+/**
+ * Lets the user select a capture file.
+ */
+void IO::Drivers::Replay::browse()
+{
+  auto dir = QFileInfo(m_filePath).absolutePath();
+  if (m_filePath.isEmpty())
+    dir = QStandardPaths::writableLocation(QStandardPaths::DocumentsLocation);
+
+  const auto file = QFileDialog::getOpenFileName(
+      nullptr, tr("Select capture file"), dir,
+      tr("Raw data captures") + QStringLiteral(" (*.sscap);;")
+          + tr("All files") + QStringLiteral(" (*)"));
+
+  if (!file.isEmpty())
+    setFilePath(file);
+}
+
+/**
+ * Changes the playback speed multiplier, which is bounded between 0.01x and
+ * 1000x. Applied the next time that a capture is opened.
+ */
+void IO::Drivers::Replay::setSpeed(const double speed)
+{
+  const auto value = qBound(0.01, speed, 1000.0);
+  if (!qFuzzyCompare(m_speed, value))
+  {
+    m_speed = value;
+    Q_EMIT speedChanged();
+  }
+}
+
+/**
+ * Changes the capture file to replay.
+ */
+void IO::Drivers::Replay::setFilePath(const QString &path)
+{
+  if (m_filePath != path)
+  {
+    m_filePath = path;
+    Q_EMIT filePathChanged();
+  }
+}
+
+/**
+ * Enables or disables replaying the capture without waiting between records.
+ * Applied the next time that a capture is opened.
+ */
+void IO::Drivers::Replay::setAsFastAsPossible(const bool enabled)
+{
+  if (m_asFastAsPossible != enabled)
+  {
+    m_asFastAsPossible = enabled;
+    Q_EMIT asFastAsPossibleChanged();
+  }
+}
+
+/**
+ * Replays the capture from its first record, called in the I/O thread.
+ */
+void IO::Drivers::Replay::start()
+{
+  m_inFlight = 0;
+  m_stalled = false;
+
+  m_reader.rewind();
+  m_pending = m_reader.next(m_record);
+  m_firstTimestamp = m_record.timestamp;
+  m_startTime = IO::monotonicTimestamp();
+
+  m_timer.start(0);
+}
+
+/**
+ * @brief Emits the records that are due, called in the I/O thread.
+ *
+ * Records are due once the time elapsed since the start of the playback,
+ * multiplied by the speed, reaches their offset in the capture, or right away
+ * in as-fast-as-possible mode. Due records are grouped into a single datagram
+ * batch, which is bounded by `kMaxBatchSize` and by the amount of data that
+ * the frame reader has not processed yet.
+ */
+void IO::Drivers::Replay::playback()
+{
+  // Stop if the capture was closed
+  if (!m_open)
+    return;
+
+  // Obtain the records that are due
+  bool stalled = false;
+  qint64 interval = 0;
+  IO::DatagramBatch batch;
+  const auto now = IO::monotonicTimestamp();
+  while (m_pending && batch.data.size() < kMaxBatchSize)
+  {
+    // Wait until the record is due
+    if (!m_playbackAsFast)
+    {
+      const auto offset = m_record.timestamp - m_firstTimestamp;
+      const auto due = m_startTime + qint64(offset / m_playbackSpeed);
+      if (due > now)
+      {
+        interval = qMin((due - now + 999999) / 1000000, kMaxInterval);
+        break;
+      }
+    }
+
+    // Wait until the frame reader processes the data that was already
+    // emitted, check again after raising the flag, it may have just done so
+    const qint64 size = m_record.size;
+    const auto inFlight = m_inFlight.load();
+    if (inFlight > 0 && inFlight + size > kMaxInFlight)
+    {
+      m_stalled = true;
+      const auto current = m_inFlight.load();
+      if ((current > 0 && current + size > kMaxInFlight)
+          || !m_stalled.exchange(false))
+      {
+        stalled = true;
+        break;
+      }
+    }
+
+    // Add the record to the batch
+    m_inFlight += size;
+    batch.data.append(m_record.data, m_record.size);
+    batch.sizes.append(static_cast<int>(m_record.size));
+    m_pending = m_reader.next(m_record);
+  }
+
+  // Publish the records
+  if (!batch.isEmpty())
+    processDatagrams(batch);
+
+  // End of the capture reached
+  if (!m_pending)
+  {
+    if (!m_finished.exchange(true))
+      QMetaObject::invokeMethod(
+          this, [=] { Q_EMIT finishedChanged(); }, Qt::QueuedConnection);
+
+    return;
+  }
+
+  // Schedule the next records
+  if (!stalled)
+    m_timer.start(static_cast<int>(interval));
+}
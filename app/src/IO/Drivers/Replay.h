@@ -0,0 +1,142 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <QTimer>
+#include <QString>
+
+#include <atomic>
+
+#include "IO/Capture.h"
+#include "IO/HAL_Driver.h"
+
+namespace IO
+{
+namespace Drivers
+{
+/**
+ * @brief The Replay class
+ *
+ * Serial Studio "driver" class that streams a raw byte capture (see
+ * `IO::Capture`) as if it was received from a real device, so that the frame
+ * reader, the parser and the dashboard can be exercised with recorded data.
+ *
+ * Records are replayed with the delays between their timestamps, divided by
+ * the speed multiplier, or as fast as the frame reader can consume them. In
+ * both cases, the amount of data that was emitted but whose frames were not
+ * yet extracted by the frame reader is bounded (see `acknowledge()`), so that
+ * the replay never floods the event queue or the buffer of the reader, and
+ * waits while the reader is stalled by the `Block` backpressure policy.
+ *
+ * Playback runs in the I/O thread of `IO::Manager`, and each group of due
+ * records is emitted as a datagram batch to keep the record boundaries.
+ */
+class Replay : public HAL_Driver
+{
+  // clang-format off
+  Q_OBJECT
+  Q_PROPERTY(QString filePath
+             READ filePath
+             WRITE setFilePath
+             NOTIFY filePathChanged)
+  Q_PROPERTY(QString fileName
+             READ fileName
+             NOTIFY filePathChanged)
+  Q_PROPERTY(double speed
+             READ speed
+             WRITE setSpeed
+             NOTIFY speedChanged)
+  Q_PROPERTY(bool asFastAsPossible
+             READ asFastAsPossible
+             WRITE setAsFastAsPossible
+             NOTIFY asFastAsPossibleChanged)
+  Q_PROPERTY(bool finished
+             READ finished
+             NOTIFY finishedChanged)
+  // clang-format on
+
+signals:
+  void speedChanged();
+  void finishedChanged();
+  void filePathChanged();
+  void asFastAsPossibleChanged();
+
+private:
+  explicit Replay();
+  Replay(Replay &&) = delete;
+  Replay(const Replay &) = delete;
+  Replay &operator=(Replay &&) = delete;
+  Replay &operator=(const Replay &) = delete;
+
+public:
+  static Replay &instance();
+
+  void close() override;
+
+  [[nodiscard]] bool isOpen() const override;
+  [[nodiscard]] bool isReadable() const override;
+  [[nodiscard]] bool isWritable() const override;
+  [[nodiscard]] bool configurationOk() const override;
+  [[nodiscard]] quint64 write(const QByteArray &data) override;
+  [[nodiscard]] bool open(const QIODevice::OpenMode mode) override;
+
+  [[nodiscard]] double speed() const;
+  [[nodiscard]] bool finished() const;
+  [[nodiscard]] qint64 pendingBytes() const;
+  [[nodiscard]] QString fileName() const;
+  [[nodiscard]] bool asFastAsPossible() const;
+  [[nodiscard]] const QString &filePath() const;
+
+  void acknowledge(const qsizetype bytes);
+
+public slots:
+  void browse();
+  void setSpeed(const double speed);
+  void setFilePath(const QString &path);
+  void setAsFastAsPossible(const bool enabled);
+
+private:
+  void start();
+  void playback();
+
+private:
+  QString m_filePath;
+  double m_speed;
+  bool m_asFastAsPossible;
+
+  std::atomic<bool> m_open;
+  std::atomic<bool> m_stalled;
+  std::atomic<bool> m_finished;
+  std::atomic<qint64> m_inFlight;
+
+  double m_playbackSpeed;
+  bool m_playbackAsFast;
+  qint64 m_startTime;
+  qint64 m_firstTimestamp;
+  bool m_pending;
+  Capture::Record m_record;
+  Capture::Reader m_reader;
+
+  QTimer m_timer;
+};
+} // namespace Drivers
+} // namespace IO
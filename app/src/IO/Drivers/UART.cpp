@@ -77,7 +77,8 @@ IO::Drivers::UART::~UART()
 }
 
 /**
- * Returns the only instance of the class
+ * Returns the instance of the class used for the main device, additional
+ * data sources create their own instances.
  */
 IO::Drivers::UART &IO::Drivers::UART::instance()
 {
@@ -96,21 +97,23 @@ void IO::Drivers::UART::close()
 {
   if (isOpen())
   {
-    port()->close();
-    port()->deleteLater();
+    auto *serial = port();
     m_port = nullptr;
+    setDeviceState(nullptr);
+    invokeOnDevice(serial, [=] {
+      serial->close();
+      serial->deleteLater();
+    });
   }
 }
 
 /**
- * Returns @c true if a serial port connection is currently open
+ * Returns @c true if a serial port connection is currently open, may be
+ * called from any thread.
  */
 bool IO::Drivers::UART::isOpen() const
 {
-  if (port())
-    return port()->isOpen();
-
-  return false;
+  return deviceOpen();
 }
 
 /**
@@ -118,10 +121,7 @@ bool IO::Drivers::UART::isOpen() const
  */
 bool IO::Drivers::UART::isReadable() const
 {
-  if (isOpen())
-    return port()->isReadable();
-
-  return false;
+  return deviceReadable();
 }
 
 /**
@@ -129,10 +129,7 @@ bool IO::Drivers::UART::isReadable() const
  */
 bool IO::Drivers::UART::isWritable() const
 {
-  if (isOpen())
-    return port()->isWritable();
-
-  return false;
+  return deviceWritable();
 }
 
 /**
@@ -155,8 +152,13 @@ bool IO::Drivers::UART::configurationOk() const
  */
 quint64 IO::Drivers::UART::write(const QByteArray &data)
 {
-  if (isWritable())
-    return port()->write(data);
+  if (auto *serial = port())
+    return invokeOnDevice(serial, [=]() -> quint64 {
+      if (serial->isOpen() && serial->isWritable())
+        return serial->write(data);
+
+      return -1;
+    });
 
   return -1;
 }
@@ -168,6 +170,10 @@ quint64 IO::Drivers::UART::write(const QByteArray &data)
  * settings and attempts to open it. If successful, it connects the necessary
  * signals for data handling and error reporting.
  *
+ * The serial port handler is moved to the I/O thread, where it is configured,
+ * opened and read. Errors are reported back to the GUI thread through a
+ * queued connection.
+ *
  * @param mode The mode in which to open the serial port (e.g., read/write).
  * @return `true` if the port is successfully opened, `false` otherwise.
  */
@@ -201,31 +207,51 @@ bool IO::Drivers::UART::open(const QIODevice::OpenMode mode)
       m_port = new QSerialPort(name);
     }
 
-    // Configure serial port
-    port()->setParity(parity());
-    port()->setBaudRate(baudRate());
-    port()->setDataBits(dataBits());
-    port()->setStopBits(stopBits());
-    port()->setFlowControl(flowControl());
+    // Move serial port handler to the I/O thread
+    auto *serial = port();
+    serial->moveToThread(ioThread());
 
-    // Connect signals/slots
-    connect(port(), &QSerialPort::errorOccurred, this,
+    // Connect signals/slots, data is read directly in the I/O thread
+    connect(serial, &QSerialPort::errorOccurred, this,
             &IO::Drivers::UART::handleError);
+    connect(serial, &QIODevice::readyRead, serial,
+            [=] { processData(serial->readAll()); });
+
+    // Keep track of the port state in the I/O thread
+    connect(serial, &QSerialPort::errorOccurred, serial,
+            [=] { setDeviceState(serial); });
+    connect(serial, &QIODevice::aboutToClose, serial,
+            [=] { setDeviceState(nullptr); });
+
+    // Configure & open the device in the I/O thread
+    QString errorString;
+    const bool opened = invokeOnDevice(serial, [&] {
+      serial->setParity(parity());
+      serial->setBaudRate(baudRate());
+      serial->setDataBits(dataBits());
+      serial->setStopBits(stopBits());
+      serial->setFlowControl(flowControl());
+
+      if (serial->open(mode))
+      {
+        serial->setDataTerminalReady(dtrEnabled());
+        setDeviceState(serial);
+        return true;
+      }
 
-    // Open device
-    if (port()->open(mode))
-    {
-      connect(port(), &QIODevice::readyRead, this,
-              &IO::Drivers::UART::onReadyRead);
-      port()->setDataTerminalReady(dtrEnabled());
+      errorString = serial->errorString();
+      return false;
+    });
+
+    // Device opened successfully
+    if (opened)
       return true;
-    }
 
     // Display error
     else
     {
       Misc::Utilities::showMessageBox(
-          tr("Failed to connect to serial port device"), port()->errorString(),
+          tr("Failed to connect to serial port device"), errorString,
           QMessageBox::Critical);
     }
   }
@@ -441,14 +467,17 @@ QSerialPort::FlowControl IO::Drivers::UART::flowControl() const
 void IO::Drivers::UART::disconnectDevice()
 {
   // Check if serial port pointer is valid
-  if (port() != nullptr)
+  if (auto *serial = port())
   {
     // Disconnect signals/slots
-    disconnect(port());
-
-    // Close & delete serial port handler
-    port()->close();
-    port()->deleteLater();
+    disconnect(serial, nullptr, this, nullptr);
+    setDeviceState(nullptr);
+
+    // Close & delete serial port handler in its own thread
+    invokeOnDevice(serial, [=] {
+      serial->close();
+      serial->deleteLater();
+    });
   }
 
   // Reset pointer & device status
@@ -487,8 +516,8 @@ void IO::Drivers::UART::setBaudRate(const qint32 rate)
   m_baudRate = rate;
 
   // Update serial port config
-  if (port())
-    port()->setBaudRate(baudRate());
+  if (auto *serial = port())
+    invokeOnDevice(serial, [=] { serial->setBaudRate(baudRate()); });
 
   // Update user interface
   Q_EMIT baudRateChanged();
@@ -510,8 +539,13 @@ void IO::Drivers::UART::setDtrEnabled(const bool enabled)
 {
   m_dtrEnabled = enabled;
 
-  if (port() && port()->isOpen())
-    port()->setDataTerminalReady(enabled);
+  if (auto *serial = port())
+  {
+    invokeOnDevice(serial, [=] {
+      if (serial->isOpen())
+        serial->setDataTerminalReady(enabled);
+    });
+  }
 
   Q_EMIT dtrEnabledChanged();
 }
@@ -530,6 +564,21 @@ void IO::Drivers::UART::setPortIndex(const quint8 portIndex)
   Q_EMIT portIndexChanged();
 }
 
+/**
+ * Selects the serial port with the given @a name, which is registered as a
+ * custom device if it is not one of the serial ports found in the system.
+ */
+void IO::Drivers::UART::setPortName(const QString &name)
+{
+  refreshSerialDevices();
+
+  const auto trimmedName = name.simplified();
+  if (!trimmedName.isEmpty() && !portList().contains(trimmedName))
+    m_customDevices.append(trimmedName);
+
+  setPortIndex(qMax(0, portList().indexOf(trimmedName)));
+}
+
 /**
  * @brief Registers a custom serial device.
  *
@@ -594,8 +643,8 @@ void IO::Drivers::UART::setParity(const quint8 parityIndex)
   }
 
   // Update serial port config.
-  if (port())
-    port()->setParity(parity());
+  if (auto *serial = port())
+    invokeOnDevice(serial, [=] { serial->setParity(parity()); });
 
   // Notify user interface
   Q_EMIT parityChanged();
@@ -649,8 +698,8 @@ void IO::Drivers::UART::setDataBits(const quint8 dataBitsIndex)
   }
 
   // Update serial port configuration
-  if (port())
-    port()->setDataBits(dataBits());
+  if (auto *serial = port())
+    invokeOnDevice(serial, [=] { serial->setDataBits(dataBits()); });
 
   // Update user interface
   Q_EMIT dataBitsChanged();
@@ -685,8 +734,8 @@ void IO::Drivers::UART::setStopBits(const quint8 stopBitsIndex)
   }
 
   // Update serial port configuration
-  if (port())
-    port()->setStopBits(stopBits());
+  if (auto *serial = port())
+    invokeOnDevice(serial, [=] { serial->setStopBits(stopBits()); });
 
   // Update user interface
   Q_EMIT stopBitsChanged();
@@ -730,8 +779,8 @@ void IO::Drivers::UART::setFlowControl(const quint8 flowControlIndex)
   }
 
   // Update serial port configuration
-  if (port())
-    port()->setFlowControl(flowControl());
+  if (auto *serial = port())
+    invokeOnDevice(serial, [=] { serial->setFlowControl(flowControl()); });
 
   // Update user interface
   Q_EMIT flowControlChanged();
@@ -775,9 +824,10 @@ void IO::Drivers::UART::refreshSerialDevices()
 
     // Update current port index
     bool indexChanged = false;
-    if (port())
+    if (auto *serial = port())
     {
-      auto name = port()->portName();
+      const auto name
+          = invokeOnDevice(serial, [=] { return serial->portName(); });
       for (int i = 0; i < validPortList.count(); ++i)
       {
         auto info = validPortList.at(i);
@@ -819,11 +869,8 @@ void IO::Drivers::UART::refreshSerialDevices()
 void IO::Drivers::UART::handleError(QSerialPort::SerialPortError error)
 {
   // Ignore if port is not open
-  if (port())
-  {
-    if (!port()->isOpen())
-      return;
-  }
+  if (port() && !isOpen())
+    return;
 
   // Log error
   if (error != QSerialPort::NoError)
@@ -846,15 +893,6 @@ void IO::Drivers::UART::handleError(QSerialPort::SerialPortError error)
   }
 }
 
-/**
- * Reads all the data from the serial port.
- */
-void IO::Drivers::UART::onReadyRead()
-{
-  if (isOpen())
-    processData(port()->readAll());
-}
-
 /**
  * Read saved settings (if any)
  */
@@ -112,15 +112,15 @@ signals:
   void connectionError(const QString &name);
 
 private:
-  explicit UART();
   UART(UART &&) = delete;
   UART(const UART &) = delete;
   UART &operator=(UART &&) = delete;
   UART &operator=(const UART &) = delete;
 
+public:
+  explicit UART();
   ~UART();
 
-public:
   static UART &instance();
 
   void close() override;
@@ -164,6 +164,7 @@ public slots:
   void setDtrEnabled(const bool enabled);
   void setParity(const quint8 parityIndex);
   void setPortIndex(const quint8 portIndex);
+  void setPortName(const QString &name);
   void registerDevice(const QString &device);
   void appendBaudRate(const QString &baudRate);
   void setDataBits(const quint8 dataBitsIndex);
@@ -172,7 +173,6 @@ public slots:
   void setFlowControl(const quint8 flowControlIndex);
 
 private slots:
-  void onReadyRead();
   void readSettings();
   void writeSettings();
   void populateErrors();
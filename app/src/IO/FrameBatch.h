@@ -0,0 +1,105 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <QVector>
+#include <QByteArray>
+
+#include <chrono>
+
+namespace IO
+{
+/**
+ * @brief Returns the current time of the monotonic clock in nanoseconds.
+ *
+ * Used to timestamp data when it enters the application, so that later stages
+ * can measure how long a frame waited before being processed.
+ */
+inline qint64 monotonicTimestamp()
+{
+  const auto now = std::chrono::steady_clock::now().time_since_epoch();
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
+}
+
+/**
+ * @brief A group of raw frames that are delivered together to other threads.
+ *
+ * Posting one event per batch instead of one event per frame keeps the
+ * cross-thread overhead constant at high frame rates. Each frame keeps the
+ * monotonic timestamp (see `monotonicTimestamp()`) of the data that
+ * completed it. All frames of a batch come from the same data source (see
+ * `IO::Source`), 0 being the main device.
+ */
+struct FrameBatch
+{
+  QVector<QByteArray> frames; /**< Raw frame data, oldest first. */
+  QVector<qint64> timestamps; /**< Ingress time of each frame (ns). */
+  int source = 0;             /**< Data source of the frames. */
+
+  /**
+   * @brief Returns @c true if the batch holds no frames.
+   */
+  [[nodiscard]] bool isEmpty() const { return frames.isEmpty(); }
+
+  /**
+   * @brief Returns the number of frames in the batch.
+   */
+  [[nodiscard]] qsizetype size() const { return frames.size(); }
+
+  /**
+   * @brief Appends a @a frame received at the given @a timestamp.
+   */
+  void append(const QByteArray &frame, const qint64 timestamp)
+  {
+    frames.append(frame);
+    timestamps.append(timestamp);
+  }
+
+  /**
+   * @brief Removes all frames from the batch.
+   */
+  void clear()
+  {
+    frames.clear();
+    timestamps.clear();
+  }
+};
+
+/**
+ * @brief A group of datagrams read from a message-oriented device in one go.
+ *
+ * The payloads are stored back to back in a single buffer, so that the batch
+ * can be handed to another thread with one allocation and appended to a byte
+ * stream with one copy, while keeping the datagram boundaries for consumers
+ * that need them.
+ */
+struct DatagramBatch
+{
+  QByteArray data;    /**< Payloads of all datagrams, in arrival order. */
+  QVector<int> sizes; /**< Size of each datagram within @c data. */
+
+  /**
+   * @brief Returns @c true if the batch holds no datagrams.
+   */
+  [[nodiscard]] bool isEmpty() const { return sizes.isEmpty(); }
+};
+} // namespace IO
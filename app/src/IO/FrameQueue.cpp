@@ -0,0 +1,228 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "IO/FrameQueue.h"
+
+/**
+ * @brief Constructs an empty queue that holds up to @a capacity frames.
+ *
+ * The default policy is `SerialStudio::Block`, which never discards frames.
+ */
+IO::FrameQueue::FrameQueue(const qsizetype capacity)
+  : m_stalled(false)
+  , m_capacity(qMax<qsizetype>(1, capacity))
+  , m_policy(SerialStudio::Block)
+  , m_droppedBytes(0)
+  , m_droppedFrames(0)
+{
+}
+
+/**
+ * @brief Returns @c true if the queue holds at least `capacity()` frames.
+ */
+bool IO::FrameQueue::isFull() const
+{
+  QMutexLocker locker(&m_mutex);
+  return m_frames.size() >= m_capacity;
+}
+
+/**
+ * @brief Returns the number of queued frames.
+ */
+qsizetype IO::FrameQueue::size() const
+{
+  QMutexLocker locker(&m_mutex);
+  return m_frames.size();
+}
+
+/**
+ * @brief Returns the maximum number of frames held by the queue.
+ */
+qsizetype IO::FrameQueue::capacity() const
+{
+  QMutexLocker locker(&m_mutex);
+  return m_capacity;
+}
+
+/**
+ * @brief Returns the number of payload bytes discarded since the last call to
+ *        `resetCounters()`.
+ *
+ * @note This function is thread-safe and lock-free.
+ */
+quint64 IO::FrameQueue::droppedBytes() const
+{
+  return m_droppedBytes.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Returns the number of frames discarded since the last call to
+ *        `resetCounters()`.
+ *
+ * @note This function is thread-safe and lock-free.
+ */
+quint64 IO::FrameQueue::droppedFrames() const
+{
+  return m_droppedFrames.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Returns the policy applied when the queue is full.
+ */
+SerialStudio::BackpressurePolicy IO::FrameQueue::policy() const
+{
+  QMutexLocker locker(&m_mutex);
+  return m_policy;
+}
+
+/**
+ * @brief Checks whether the producer must stop generating frames.
+ *
+ * Only applies to the `SerialStudio::Block` policy. If the queue is full, it
+ * is marked as stalled, and the next call to `takeAll()` reports that the
+ * producer has to be resumed.
+ *
+ * @return @c true if the producer should wait for the consumer.
+ */
+bool IO::FrameQueue::stall()
+{
+  QMutexLocker locker(&m_mutex);
+  if (m_policy == SerialStudio::Block && m_frames.size() >= m_capacity)
+  {
+    m_stalled = true;
+    return true;
+  }
+
+  return false;
+}
+
+/**
+ * @brief Appends all frames of @a batch to the queue and applies the
+ *        backpressure policy if the capacity is exceeded.
+ *
+ * @return @c true if the queue was empty, meaning that the consumer has to be
+ *         notified that new frames are available.
+ */
+bool IO::FrameQueue::push(const FrameBatch &batch)
+{
+  if (batch.isEmpty())
+    return false;
+
+  QMutexLocker locker(&m_mutex);
+  const bool wasEmpty = m_frames.isEmpty();
+
+  // Share the incoming batch if the queue is empty, append it otherwise
+  if (wasEmpty)
+    m_frames = batch;
+  else
+  {
+    m_frames.frames.append(batch.frames);
+    m_frames.timestamps.append(batch.timestamps);
+  }
+
+  // Apply the backpressure policy
+  const auto excess = m_frames.size() - m_capacity;
+  if (excess > 0)
+  {
+    if (m_policy == SerialStudio::DropOldest)
+      dropOldest(excess);
+    else if (m_policy == SerialStudio::KeepLatest)
+      dropOldest(m_frames.size() - 1);
+  }
+
+  return wasEmpty;
+}
+
+/**
+ * @brief Removes and returns all queued frames.
+ *
+ * @param resume Set to @c true if the producer stalled on this queue and must
+ *               be resumed by the caller.
+ */
+IO::FrameBatch IO::FrameQueue::takeAll(bool *resume)
+{
+  FrameBatch batch;
+
+  QMutexLocker locker(&m_mutex);
+  std::swap(batch, m_frames);
+  if (resume)
+    *resume = m_stalled;
+
+  m_stalled = false;
+  return batch;
+}
+
+/**
+ * @brief Discards all queued frames without counting them as dropped.
+ */
+void IO::FrameQueue::clear()
+{
+  QMutexLocker locker(&m_mutex);
+  m_frames.clear();
+  m_stalled = false;
+}
+
+/**
+ * @brief Sets the dropped frame and byte counters to zero.
+ */
+void IO::FrameQueue::resetCounters()
+{
+  m_droppedBytes.store(0, std::memory_order_relaxed);
+  m_droppedFrames.store(0, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Changes the maximum number of queued frames.
+ *
+ * The new capacity is enforced on the next push.
+ */
+void IO::FrameQueue::setCapacity(const qsizetype capacity)
+{
+  QMutexLocker locker(&m_mutex);
+  m_capacity = qMax<qsizetype>(1, capacity);
+}
+
+/**
+ * @brief Changes the policy applied when the queue is full.
+ */
+void IO::FrameQueue::setPolicy(const SerialStudio::BackpressurePolicy policy)
+{
+  QMutexLocker locker(&m_mutex);
+  m_policy = policy;
+}
+
+/**
+ * @brief Discards the @a count oldest frames and updates the drop counters.
+ *
+ * @note The caller must hold the queue lock.
+ */
+void IO::FrameQueue::dropOldest(const qsizetype count)
+{
+  quint64 bytes = 0;
+  for (qsizetype i = 0; i < count; ++i)
+    bytes += static_cast<quint64>(m_frames.frames.at(i).size());
+
+  m_frames.frames.remove(0, count);
+  m_frames.timestamps.remove(0, count);
+
+  m_droppedBytes.fetch_add(bytes, std::memory_order_relaxed);
+  m_droppedFrames.fetch_add(count, std::memory_order_relaxed);
+}
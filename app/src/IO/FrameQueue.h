@@ -0,0 +1,89 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <QMutex>
+
+#include <atomic>
+
+#include "SerialStudio.h"
+#include "IO/FrameBatch.h"
+
+namespace IO
+{
+/**
+ * @class IO::FrameQueue
+ * @brief Bounded, thread-safe queue of frames between two pipeline stages.
+ *
+ * The producer pushes whole batches and the consumer drains the queue at once,
+ * so the lock is taken once per batch on each side. The producer only needs to
+ * notify the consumer when it pushes into an empty queue; while frames are
+ * pending, later batches are coalesced with them instead of posting more
+ * events.
+ *
+ * When a push would exceed the capacity, the configured
+ * `SerialStudio::BackpressurePolicy` decides what happens:
+ * - **Block**: the batch is accepted, but `stall()` reports the queue as full
+ *   so that the producer stops generating frames until the consumer drains it.
+ *   The queue may therefore exceed its capacity by the frames that the
+ *   producer generated since it last checked.
+ * - **DropOldest**: the oldest frames are discarded to make room.
+ * - **KeepLatest**: all frames except the most recent one are discarded.
+ *
+ * Discarded frames and their payload bytes are counted.
+ */
+class FrameQueue
+{
+public:
+  explicit FrameQueue(const qsizetype capacity = 4096);
+
+  [[nodiscard]] bool isFull() const;
+  [[nodiscard]] qsizetype size() const;
+  [[nodiscard]] qsizetype capacity() const;
+  [[nodiscard]] quint64 droppedBytes() const;
+  [[nodiscard]] quint64 droppedFrames() const;
+  [[nodiscard]] SerialStudio::BackpressurePolicy policy() const;
+
+  bool stall();
+  bool push(const FrameBatch &batch);
+  [[nodiscard]] FrameBatch takeAll(bool *resume = nullptr);
+
+  void clear();
+  void resetCounters();
+  void setCapacity(const qsizetype capacity);
+  void setPolicy(const SerialStudio::BackpressurePolicy policy);
+
+private:
+  void dropOldest(const qsizetype count);
+
+private:
+  mutable QMutex m_mutex;
+
+  bool m_stalled;
+  FrameBatch m_frames;
+  qsizetype m_capacity;
+  SerialStudio::BackpressurePolicy m_policy;
+
+  std::atomic<quint64> m_droppedBytes;
+  std::atomic<quint64> m_droppedFrames;
+};
+} // namespace IO
@@ -21,10 +21,183 @@
 
 #include "FrameReader.h"
 
+#include <cstring>
+
 #include "IO/Manager.h"
 #include "IO/Checksum.h"
 #include "JSON/FrameBuilder.h"
 #include "JSON/ProjectModel.h"
+#include "Misc/LatencyMonitor.h"
+
+namespace
+{
+/**
+ * @brief Maximum number of frames held in a batch before it is published,
+ *        regardless of the configured batch latency.
+ */
+constexpr qsizetype kMaxBatchSize = 1024;
+
+/**
+ * @brief Describes the trailer sent after the frame delimiter for a checksum
+ *        algorithm: a textual header followed by the checksum in big-endian
+ *        byte order.
+ */
+struct ChecksumTrailer
+{
+  SerialStudio::ChecksumAlgorithm algorithm;
+  QByteArray header;
+  qsizetype length;
+};
+
+/**
+ * @brief Returns the trailer format of every supported checksum algorithm.
+ */
+const QVector<ChecksumTrailer> &checksumTrailers()
+{
+  // clang-format off
+  static const QVector<ChecksumTrailer> trailers = {
+    {SerialStudio::CRC8,        QByteArrayLiteral("crc8:"),       1},
+    {SerialStudio::CRC16,       QByteArrayLiteral("crc16:"),      2},
+    {SerialStudio::CRC32,       QByteArrayLiteral("crc32:"),      4},
+    {SerialStudio::CRC16Modbus, QByteArrayLiteral("modbus:"),     2},
+    {SerialStudio::CRC32C,      QByteArrayLiteral("crc32c:"),     4},
+    {SerialStudio::Fletcher16,  QByteArrayLiteral("fletcher16:"), 2},
+    {SerialStudio::XOR8,        QByteArrayLiteral("xor8:"),       1},
+    {SerialStudio::Sum8,        QByteArrayLiteral("sum8:"),       1},
+  };
+  // clang-format on
+
+  return trailers;
+}
+
+/**
+ * @brief Computes the checksum of @a frame using the given @a algorithm.
+ */
+quint32 computeChecksum(const SerialStudio::ChecksumAlgorithm algorithm,
+                        const QByteArray &frame)
+{
+  const auto *data = frame.constData();
+  const auto length = static_cast<int>(frame.length());
+  switch (algorithm)
+  {
+    case SerialStudio::CRC8:
+      return IO::crc8(data, length);
+    case SerialStudio::CRC16:
+      return IO::crc16(data, length);
+    case SerialStudio::CRC32:
+      return IO::crc32(data, length);
+    case SerialStudio::CRC16Modbus:
+      return IO::crc16Modbus(data, length);
+    case SerialStudio::CRC32C:
+      return IO::crc32c(data, length);
+    case SerialStudio::Fletcher16:
+      return IO::fletcher16(data, length);
+    case SerialStudio::XOR8:
+      return IO::xor8(data, length);
+    case SerialStudio::Sum8:
+      return IO::sum8(data, length);
+    default:
+      return 0;
+  }
+}
+
+/**
+ * @brief Decodes a COBS-encoded packet, excluding its 0x00 delimiter.
+ *
+ * Each code byte tells how many bytes follow until the next zero byte of the
+ * original data, so whole runs are copied with a single `memcpy()`.
+ *
+ * @param packet The encoded packet.
+ * @param frame Receives the decoded data.
+ * @return @c true if the packet is well-formed.
+ */
+bool cobsDecode(const QByteArray &packet, QByteArray &frame)
+{
+  const auto size = packet.size();
+  const auto *in = packet.constData();
+
+  frame.resize(size);
+  auto *out = frame.data();
+
+  qsizetype read = 0;
+  qsizetype written = 0;
+  while (read < size)
+  {
+    // Validate the code byte
+    const qsizetype code = static_cast<quint8>(in[read++]);
+    if (code == 0 || read + code - 1 > size)
+      return false;
+
+    // Copy the run of non-zero bytes
+    std::memcpy(out + written, in + read, code - 1);
+    written += code - 1;
+    read += code - 1;
+
+    // Restore the zero byte, unless the run was a full 254-byte block
+    if (code < 0xFF && read < size)
+      out[written++] = 0;
+  }
+
+  frame.truncate(written);
+  return true;
+}
+
+/**
+ * @brief Decodes a SLIP-encoded packet, excluding its 0xC0 delimiter.
+ *
+ * Data between escape bytes is located with `memchr()` and copied in bulk.
+ *
+ * @param packet The encoded packet.
+ * @param frame Receives the decoded data.
+ * @return @c true if the packet contains only valid escape sequences.
+ */
+bool slipDecode(const QByteArray &packet, QByteArray &frame)
+{
+  constexpr char kEnd = '\xC0';
+  constexpr char kEsc = '\xDB';
+  constexpr char kEscEnd = '\xDC';
+  constexpr char kEscEsc = '\xDD';
+
+  const auto size = packet.size();
+  const auto *in = packet.constData();
+
+  frame.resize(size);
+  auto *out = frame.data();
+
+  qsizetype read = 0;
+  qsizetype written = 0;
+  while (read < size)
+  {
+    // Copy everything up to the next escape byte
+    const auto *esc = static_cast<const char *>(
+        std::memchr(in + read, kEsc, static_cast<size_t>(size - read)));
+    const qsizetype run = esc ? esc - (in + read) : size - read;
+    std::memcpy(out + written, in + read, run);
+    written += run;
+    read += run;
+
+    // Replace the escape sequence with the original byte
+    if (read < size)
+    {
+      if (read + 1 >= size)
+        return false;
+
+      const char next = in[read + 1];
+      if (next == kEscEnd)
+        out[written++] = kEnd;
+      else if (next == kEscEsc)
+        out[written++] = kEsc;
+      else
+        return false;
+
+      read += 2;
+    }
+  }
+
+  frame.truncate(written);
+  return true;
+}
+} // namespace
 
 /**
  * @brief Constructs a FrameReader object.
@@ -37,14 +210,34 @@
  */
 IO::FrameReader::FrameReader(QObject *parent)
   : QObject(parent)
-  , m_enableCrc(false)
+  , m_batchLatency(0)
+  , m_ingressTime(0)
+  , m_unprocessedBytes(0)
+  , m_batchTimer(new QTimer(this))
+  , m_resynchronizing(false)
+  , m_awaitingChecksum(false)
+  , m_checksum(SerialStudio::AutoDetectChecksum)
+  , m_checksumAlgorithm(SerialStudio::AutoDetectChecksum)
+  , m_checksumErrors(0)
+  , m_incompleteChecksums(0)
+  , m_resyncCount(0)
+  , m_framingErrors(0)
+  , m_ingressDroppedBytes(0)
+  , m_bytesReceived(0)
+  , m_framesExtracted(0)
+  , m_skippedFrames(0)
+  , m_delayedFrames(0)
   , m_operationMode(SerialStudio::QuickPlot)
   , m_frameDetectionMode(SerialStudio::EndDelimiterOnly)
   , m_dataBuffer(1024 * 1024)
 {
-  m_quickPlotEndSequences.append(QByteArray("\n"));
-  m_quickPlotEndSequences.append(QByteArray("\r"));
-  m_quickPlotEndSequences.append(QByteArray("\r\n"));
+  m_quickPlotScanner.setPatterns({"\n", "\r", "\r\n"});
+  m_frameScanner.setPatterns({m_finishSequence}, {m_startSequence});
+  m_syncWordScanner.setPatterns({m_lengthPrefix.syncWord});
+
+  m_batchTimer->setSingleShot(true);
+  m_batchTimer->setTimerType(Qt::PreciseTimer);
+  connect(m_batchTimer, &QTimer::timeout, this, &FrameReader::flushFrames);
 }
 
 /**
@@ -97,17 +290,235 @@ const QByteArray &IO::FrameReader::finishSequence() const
   return m_finishSequence;
 }
 
+/**
+ * @brief Returns the number of frames rejected due to a checksum mismatch or a
+ *        missing checksum trailer since the last reset.
+ *
+ * @note This function is thread-safe.
+ */
+quint64 IO::FrameReader::checksumErrors() const
+{
+  return m_checksumErrors.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Returns the number of frames that had to wait for the rest of their
+ *        checksum trailer since the last reset.
+ *
+ * @note This function is thread-safe.
+ */
+quint64 IO::FrameReader::incompleteChecksums() const
+{
+  return m_incompleteChecksums.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Retrieves the checksum algorithm configured for the current project.
+ *
+ * @return The checksum algorithm as a SerialStudio::ChecksumAlgorithm enum.
+ */
+SerialStudio::ChecksumAlgorithm IO::FrameReader::checksumAlgorithm() const
+{
+  return m_checksumAlgorithm;
+}
+
+/**
+ * @brief Returns the maximum time (in milliseconds) that an extracted frame
+ *        may wait before its batch is published.
+ *
+ * A latency of zero publishes one batch per wake-up of the worker thread.
+ */
+int IO::FrameReader::batchLatency() const
+{
+  return m_batchLatency;
+}
+
+/**
+ * @brief Returns the number of times that the reader lost synchronization with
+ *        a length-prefixed stream since the last reset.
+ *
+ * @note This function is thread-safe.
+ */
+quint64 IO::FrameReader::resyncCount() const
+{
+  return m_resyncCount.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Returns the number of malformed COBS or SLIP packets that were
+ *        dropped since the last reset.
+ *
+ * @note This function is thread-safe.
+ */
+quint64 IO::FrameReader::framingErrors() const
+{
+  return m_framingErrors.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Retrieves the header layout used in length-prefixed mode.
+ *
+ * @return A reference to the current length-prefixed frame format.
+ */
+const IO::LengthPrefixFormat &IO::FrameReader::lengthPrefixFormat() const
+{
+  return m_lengthPrefix;
+}
+
+/**
+ * @brief Returns the number of frame payload bytes discarded by the output
+ *        queue since the last reset.
+ *
+ * @note This function is thread-safe.
+ */
+quint64 IO::FrameReader::droppedBytes() const
+{
+  return m_queue.droppedBytes();
+}
+
+/**
+ * @brief Returns the number of frames discarded by the output queue since the
+ *        last reset.
+ *
+ * @note This function is thread-safe.
+ */
+quint64 IO::FrameReader::droppedFrames() const
+{
+  return m_queue.droppedFrames();
+}
+
+/**
+ * @brief Returns the number of received bytes that were discarded before
+ *        frame extraction since the last reset, either because the circular
+ *        buffer overflowed or because the output queue was blocked.
+ *
+ * @note This function is thread-safe.
+ */
+quint64 IO::FrameReader::ingressDroppedBytes() const
+{
+  return m_ingressDroppedBytes.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Returns the number of bytes received from the device since the last
+ *        reset.
+ *
+ * @note This function is thread-safe.
+ */
+quint64 IO::FrameReader::bytesReceived() const
+{
+  return m_bytesReceived.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Returns the number of frames extracted from the received data since
+ *        the last reset, including frames later dropped by the output queue.
+ *
+ * @note This function is thread-safe.
+ */
+quint64 IO::FrameReader::framesExtracted() const
+{
+  return m_framesExtracted.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Returns the number of empty frames and of finish sequences without a
+ *        preceding start sequence that were skipped since the last reset.
+ *
+ * @note This function is thread-safe.
+ */
+quint64 IO::FrameReader::skippedFrames() const
+{
+  return m_skippedFrames.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Returns a snapshot of all the counters of the reader & the number of
+ *        frames waiting in its output queue.
+ *
+ * @note This function is thread-safe.
+ */
+IO::FrameReaderStatistics IO::FrameReader::statistics() const
+{
+  FrameReaderStatistics stats;
+  stats.bytesReceived = bytesReceived();
+  stats.framesExtracted = framesExtracted();
+  stats.checksumErrors = checksumErrors();
+  stats.skippedFrames = skippedFrames();
+  stats.framingErrors = framingErrors();
+  stats.resyncCount = resyncCount();
+  stats.queuedFrames = static_cast<quint64>(m_queue.size())
+                       + m_delayedFrames.load(std::memory_order_relaxed);
+  stats.droppedFrames = droppedFrames();
+  stats.droppedBytes = droppedBytes();
+  stats.ingressDroppedBytes = ingressDroppedBytes();
+  return stats;
+}
+
+/**
+ * @brief Removes and returns all frames waiting in the output queue.
+ *
+ * Meant to be called by the consumer after `framesReady()` is emitted. If the
+ * reader stopped extracting frames because the queue was full, extraction is
+ * resumed in the worker thread.
+ *
+ * @note This function is thread-safe.
+ */
+IO::FrameBatch IO::FrameReader::takeFrames()
+{
+  bool resume = false;
+  auto batch = m_queue.takeAll(&resume);
+  if (resume)
+    QMetaObject::invokeMethod(this, &FrameReader::readFrames,
+                              Qt::QueuedConnection);
+
+  return batch;
+}
+
 /**
  * @brief Resets the FrameReader's state.
  *
- * Clears the internal data buffer, resets CRC settings, and reserves space for
- * the buffer. This is useful when reinitializing or repurposing the FrameReader
- * in a multithreaded environment.
+ * Clears the internal data buffer, resets CRC settings & statistics and forgets
+ * the progress of all delimiter scanners. Frames that were not published yet
+ * are discarded. This is useful when reinitializing or
+ * repurposing the FrameReader in a multithreaded environment.
+ *
+ * The checksum algorithm is only taken from the project in project mode, other
+ * modes detect the checksum trailer (if any) automatically.
  */
 void IO::FrameReader::reset()
 {
-  m_enableCrc = false;
+  m_resynchronizing = false;
+  m_awaitingChecksum = false;
+  m_resyncCount.store(0, std::memory_order_relaxed);
+  m_framingErrors.store(0, std::memory_order_relaxed);
+  m_checksumErrors.store(0, std::memory_order_relaxed);
+  m_ingressDroppedBytes.store(0, std::memory_order_relaxed);
+  m_incompleteChecksums.store(0, std::memory_order_relaxed);
+  m_bytesReceived.store(0, std::memory_order_relaxed);
+  m_framesExtracted.store(0, std::memory_order_relaxed);
+  m_skippedFrames.store(0, std::memory_order_relaxed);
+  m_checksum = m_operationMode == SerialStudio::ProjectFile
+                   ? m_checksumAlgorithm
+                   : SerialStudio::AutoDetectChecksum;
+
   m_dataBuffer.clear();
+  acknowledgeData();
+
+  m_batch.clear();
+  m_batchTimer->stop();
+  m_delayedFrames.store(0, std::memory_order_relaxed);
+
+  m_queue.clear();
+  m_queue.resetCounters();
+
+  m_startScanner.reset();
+  m_frameScanner.reset();
+  m_finishScanner.reset();
+  m_nextStartScanner.reset();
+  m_syncWordScanner.reset();
+  m_packetScanner.reset();
+  m_quickPlotScanner.reset();
 }
 
 /**
@@ -121,6 +532,8 @@ void IO::FrameReader::setupExternalConnections()
 {
   setOperationMode(JSON::FrameBuilder::instance().operationMode());
   setFrameDetectionMode(JSON::ProjectModel::instance().frameDetection());
+  setChecksumAlgorithm(JSON::ProjectModel::instance().checksumAlgorithm());
+  setLengthPrefixFormat(JSON::ProjectModel::instance().lengthPrefixFormat());
 
   connect(&JSON::FrameBuilder::instance(),
           &JSON::FrameBuilder::operationModeChanged, this, [=] {
@@ -132,6 +545,60 @@ void IO::FrameReader::setupExternalConnections()
             setFrameDetectionMode(
                 JSON::ProjectModel::instance().frameDetection());
           });
+
+  connect(&JSON::ProjectModel::instance(),
+          &JSON::ProjectModel::checksumAlgorithmChanged, this, [=] {
+            setChecksumAlgorithm(
+                JSON::ProjectModel::instance().checksumAlgorithm());
+          });
+
+  connect(&JSON::ProjectModel::instance(),
+          &JSON::ProjectModel::lengthPrefixFormatChanged, this, [=] {
+            setLengthPrefixFormat(
+                JSON::ProjectModel::instance().lengthPrefixFormat());
+          });
+}
+
+/**
+ * @brief Changes the maximum time that extracted frames may be held back in
+ *        order to publish them in larger batches.
+ *
+ * Larger batches reduce the number of events posted to other threads, at the
+ * cost of added latency. The value is limited to one second.
+ *
+ * @param milliseconds The batch latency bound, zero to publish every wake-up.
+ */
+void IO::FrameReader::setBatchLatency(const int milliseconds)
+{
+  m_batchLatency = qBound(0, milliseconds, 1000);
+  if (m_batchLatency == 0)
+    flushFrames();
+}
+
+/**
+ * @brief Changes the maximum number of frames that may wait in the output
+ *        queue until the consumer collects them.
+ *
+ * @note This function is thread-safe.
+ */
+void IO::FrameReader::setQueueCapacity(const int frames)
+{
+  m_queue.setCapacity(frames);
+}
+
+/**
+ * @brief Changes what happens when the output queue is full.
+ *
+ * With `SerialStudio::Block`, frame extraction is paused until the consumer
+ * catches up, and received data accumulates in the circular buffer. The other
+ * policies keep extracting frames and discard queued ones instead.
+ *
+ * @note This function is thread-safe.
+ */
+void IO::FrameReader::setBackpressurePolicy(
+    const SerialStudio::BackpressurePolicy policy)
+{
+  m_queue.setPolicy(policy);
 }
 
 /**
@@ -151,19 +618,110 @@ void IO::FrameReader::processData(const QByteArray &data)
   if (!IO::Manager::instance().isConnected())
     return;
 
-  // Add data to circular buffer
-  m_dataBuffer.append(data);
-  Q_EMIT dataReceived(data);
+  // Timestamp the frames completed by this data
+  m_ingressTime = IO::monotonicTimestamp();
+  m_bytesReceived.fetch_add(data.size(), std::memory_order_relaxed);
 
-  // Read frames in no-delimiter mode directly
+  // Read frames in no-delimiter mode directly, bypassing the circular buffer
   if (m_operationMode == SerialStudio::ProjectFile
       && m_frameDetectionMode == SerialStudio::NoDelimiters)
-    Q_EMIT frameReady(m_dataBuffer.read(data.size()));
+  {
+    Q_EMIT dataReceived(data);
+
+    // There is no buffer to hold the data while the output queue is blocked,
+    // it is acknowledged once readFrames() resumes after takeFrames()
+    m_unprocessedBytes += data.size();
+    if (m_queue.stall())
+    {
+      m_ingressDroppedBytes.fetch_add(data.size(), std::memory_order_relaxed);
+      return;
+    }
+
+    enqueueFrame(data);
+    publishFrames();
+    acknowledgeData();
+    return;
+  }
+
+  // Append the data in chunks that fit in the circular buffer, frames are
+  // extracted after each chunk before the next one needs room
+  const auto capacity = m_dataBuffer.capacity();
+  for (qsizetype offset = 0; offset < data.size(); offset += capacity)
+  {
+    // Extract the frames of the previous chunk
+    if (offset > 0)
+      readFrames();
+
+    // Discard the oldest bytes if there is not enough room for the new data
+    const auto length = qMin(capacity, data.size() - offset);
+    const auto missing = length - m_dataBuffer.freeSpace();
+    if (missing > 0)
+    {
+      const auto discarded = qMin(missing, m_dataBuffer.size());
+      m_ingressDroppedBytes.fetch_add(discarded, std::memory_order_relaxed);
+      consume(discarded);
+    }
+
+    // Add data to circular buffer
+    (void)m_dataBuffer.append(data.constData() + offset, length);
+    m_unprocessedBytes += length;
+  }
+
+  Q_EMIT dataReceived(data);
 
   // Schedule a frame extraction as soon as possible without blocking the thread
-  else
-    QMetaObject::invokeMethod(this, &FrameReader::readFrames,
-                              Qt::QueuedConnection);
+  QMetaObject::invokeMethod(this, &FrameReader::readFrames,
+                            Qt::QueuedConnection);
+}
+
+/**
+ * @brief Processes a group of datagrams received at once.
+ *
+ * In no-delimiter mode every datagram is a frame. Other modes handle the
+ * datagrams as a contiguous stream, so the whole batch is appended to the
+ * circular buffer with a single copy.
+ *
+ * @param batch The datagrams read from the device.
+ */
+void IO::FrameReader::processDatagrams(const IO::DatagramBatch &batch)
+{
+  // Treat datagrams as a byte stream, unless they are frames on their own
+  if (m_operationMode != SerialStudio::ProjectFile
+      || m_frameDetectionMode != SerialStudio::NoDelimiters)
+  {
+    processData(batch.data);
+    return;
+  }
+
+  // Stop if not connected
+  if (!IO::Manager::instance().isConnected())
+    return;
+
+  // Timestamp the frames and publish the raw data
+  m_ingressTime = IO::monotonicTimestamp();
+  m_bytesReceived.fetch_add(batch.data.size(), std::memory_order_relaxed);
+  Q_EMIT dataReceived(batch.data);
+
+  // There is no buffer to hold the data while the output queue is blocked,
+  // it is acknowledged once readFrames() resumes after takeFrames()
+  m_unprocessedBytes += batch.data.size();
+  if (m_queue.stall())
+  {
+    m_ingressDroppedBytes.fetch_add(batch.data.size(),
+                                    std::memory_order_relaxed);
+    return;
+  }
+
+  // Publish each datagram as a frame
+  qsizetype offset = 0;
+  for (const auto size : batch.sizes)
+  {
+    enqueueFrame(batch.data.mid(offset, size));
+    offset += size;
+  }
+
+  publishFrames();
+  acknowledgeData();
 }
 
 /**
@@ -180,6 +738,9 @@ void IO::FrameReader::setStartSequence(const QString &start)
   if (m_startSequence != data)
   {
     m_startSequence = data;
+    m_startScanner.setPattern(data);
+    m_nextStartScanner.setPattern(data);
+    m_frameScanner.setPatterns({m_finishSequence}, {m_startSequence});
     reset();
   }
 }
@@ -198,6 +759,8 @@ void IO::FrameReader::setFinishSequence(const QString &finish)
   if (m_finishSequence != data)
   {
     m_finishSequence = data;
+    m_finishScanner.setPatterns({m_finishSequence});
+    m_frameScanner.setPatterns({m_finishSequence}, {m_startSequence});
     reset();
   }
 }
@@ -223,8 +786,9 @@ void IO::FrameReader::setOperationMode(const SerialStudio::OperationMode mode)
  * @brief Sets the frame detection mode for the FrameReader.
  *
  * Specifies how frames are detected, either by end delimiter only or both
- * start and end delimiters. Resets the FrameReader state if the frame detection
- * mode changes.
+ * start and end delimiters. COBS and SLIP modes also select the single byte
+ * that delimits encoded packets. Resets the FrameReader state if the frame
+ * detection mode changes.
  *
  * @param mode The new frame detection mode as a SerialStudio::FrameDetection
  * enum.
@@ -235,6 +799,59 @@ void IO::FrameReader::setFrameDetectionMode(
   if (m_frameDetectionMode != mode)
   {
     m_frameDetectionMode = mode;
+
+    if (mode == SerialStudio::COBS)
+      m_packetScanner.setPatterns({QByteArray(1, '\x00')});
+    else if (mode == SerialStudio::SLIP)
+      m_packetScanner.setPatterns({QByteArray(1, '\xC0')});
+    else
+      m_packetScanner.setPatterns({});
+
+    reset();
+  }
+}
+
+/**
+ * @brief Sets the checksum algorithm used to validate frames in project mode.
+ *
+ * Resets the FrameReader state if the checksum algorithm changes.
+ *
+ * @param algorithm The new checksum algorithm as a
+ *                  SerialStudio::ChecksumAlgorithm enum.
+ */
+void IO::FrameReader::setChecksumAlgorithm(
+    const SerialStudio::ChecksumAlgorithm algorithm)
+{
+  if (m_checksumAlgorithm != algorithm)
+  {
+    m_checksumAlgorithm = algorithm;
+    reset();
+  }
+}
+
+/**
+ * @brief Sets the header layout of length-prefixed binary frames.
+ *
+ * The length field width is limited to 1-4 bytes, and the maximum payload
+ * length is capped to half of the buffer capacity, so that a corrupted length
+ * field can never stall the reader for longer than the buffer can hold.
+ * Resets the FrameReader state if the format changes.
+ *
+ * @param format The new length-prefixed frame format.
+ */
+void IO::FrameReader::setLengthPrefixFormat(
+    const IO::LengthPrefixFormat &format)
+{
+  auto f = format;
+  f.lengthSize = qBound(1, f.lengthSize, 4);
+  f.lengthOffset = qMax(0, f.lengthOffset);
+  f.maxLength = qBound(0, f.maxLength,
+                       static_cast<int>(m_dataBuffer.capacity() / 2));
+
+  if (m_lengthPrefix != f)
+  {
+    m_lengthPrefix = f;
+    m_syncWordScanner.setPatterns({m_lengthPrefix.syncWord});
     reset();
   }
 }
@@ -251,6 +868,10 @@ void IO::FrameReader::readFrames()
     return;
   }
 
+  // Output queue is full, wait until the consumer calls takeFrames()
+  if (m_queue.stall())
+    return;
+
   // JSON mode, read until default frame start & end sequences are found
   if (m_operationMode == SerialStudio::DeviceSendsJSON)
     readStartEndDelimetedFrames();
@@ -269,18 +890,75 @@ void IO::FrameReader::readFrames()
     // Read using both a start & end delimiter
     else if (m_frameDetectionMode == SerialStudio::StartAndEndDelimiter)
       readStartEndDelimetedFrames();
+
+    // Read using a sync word & a length field
+    else if (m_frameDetectionMode == SerialStudio::LengthPrefixed)
+      readLengthPrefixedFrames();
+
+    // Read COBS or SLIP encoded packets
+    else if (m_frameDetectionMode == SerialStudio::COBS
+             || m_frameDetectionMode == SerialStudio::SLIP)
+      readEncodedFrames();
   }
 
   // Handle quick plot data
   else if (m_operationMode == SerialStudio::QuickPlot)
     readEndDelimetedFrames();
+
+  // Send the extracted frames to the rest of the application
+  publishFrames();
+  acknowledgeData();
+}
+
+/**
+ * @brief Emits `dataProcessed()` with the number of bytes received since the
+ *        last call.
+ *
+ * Called once frames have been extracted from all the buffered data, so that
+ * the data that is still waiting for the reader, either in its event queue or
+ * in the circular buffer while the output queue is stalled, is not counted.
+ * Bytes that are kept in the buffer because they are an incomplete frame are
+ * counted, they only need more data to be extracted.
+ */
+void IO::FrameReader::acknowledgeData()
+{
+  if (m_unprocessedBytes > 0)
+  {
+    Q_EMIT dataProcessed(m_unprocessedBytes);
+    m_unprocessedBytes = 0;
+  }
+}
+
+/**
+ * @brief Publishes the pending batch of frames.
+ *
+ * Pushes all frames extracted since the last batch to the output queue and
+ * starts a new batch. `framesReady()` is only emitted if the queue was empty,
+ * otherwise the consumer has not collected the previous frames yet and will
+ * receive these ones with them. Called when the batch latency expires, when
+ * the batch is full, or directly when no batch latency is configured.
+ */
+void IO::FrameReader::flushFrames()
+{
+  m_batchTimer->stop();
+  if (m_batch.isEmpty())
+    return;
+
+  m_framesExtracted.fetch_add(m_batch.size(), std::memory_order_relaxed);
+  Misc::LatencyMonitor::instance().record(Misc::LatencyMonitor::Framing,
+                                          m_batch.timestamps);
+  if (m_queue.push(m_batch))
+    Q_EMIT framesReady();
+
+  m_batch.clear();
+  m_delayedFrames.store(0, std::memory_order_relaxed);
 }
 
 /**
  * @brief Reads frames delimited by an end sequence from the buffer.
  *
  * Extracts frames from the circular buffer that are terminated by a specified
- * end delimiter. Emits `frameReady` for each valid frame. Handles oversized
+ * end delimiter. Queues each valid frame for publishing. Handles oversized
  * frames gracefully and stops processing if data is incomplete.
  */
 void IO::FrameReader::readEndDelimetedFrames()
@@ -296,65 +974,54 @@ void IO::FrameReader::readEndDelimetedFrames()
     int endIndex = -1;
     QByteArray delimiter;
 
-    // Find the earliest finish sequence in the buffer (QuickPlot mode)
+    // Find the earliest line ending in the buffer (QuickPlot mode)
     if (m_operationMode == SerialStudio::QuickPlot)
     {
-      for (const QByteArray &d : m_quickPlotEndSequences)
-      {
-        int index = m_dataBuffer.findPatternKMP(d);
-        if (index != -1 && (endIndex == -1 || index < endIndex))
-        {
-          endIndex = index;
-          delimiter = d;
-        }
-      }
+      endIndex = m_dataBuffer.findDelimiter(m_quickPlotScanner);
+      if (endIndex != -1)
+        delimiter = m_quickPlotScanner.delimiters[m_quickPlotScanner.delimiter];
     }
 
     // Find the earliest finish sequence in the buffer (project mode)
     else if (m_frameDetectionMode == SerialStudio::EndDelimiterOnly)
     {
       delimiter = m_finishSequence;
-      endIndex = m_dataBuffer.findPatternKMP(delimiter);
+      endIndex = m_dataBuffer.findDelimiter(m_finishScanner);
     }
 
     // No complete frame found
     if (endIndex == -1)
       break;
 
-    // Extract the frame up to the delimiter
-    qsizetype frameLength = endIndex;
-    QByteArray frame = m_dataBuffer.peek(frameLength);
+    // Obtain a zero-copy view of the frame up to the delimiter
+    const QByteArray frame = m_dataBuffer.view(0, endIndex);
 
     // Parse frame if not empty
     if (!frame.isEmpty())
     {
       // Checksum verification & emit frame if valid
       qsizetype chop = 0;
-      auto result = integrityChecks(frame, delimiter, &chop);
+      auto result = integrityChecks(frame, delimiter, endIndex, &chop);
       if (result == ValidationStatus::FrameOk)
       {
-        Q_EMIT frameReady(frame);
-        qsizetype bytesToRemove = endIndex + chop;
-        (void)m_dataBuffer.read(bytesToRemove);
+        enqueueFrame(QByteArray(frame.constData(), frame.size()));
+        consume(endIndex + chop);
       }
 
       // Incomplete data; wait for more data
       else if (result == ValidationStatus::ChecksumIncomplete)
         break;
 
-      // Invalid frame; skip past finish sequence
+      // Invalid frame; skip past finish sequence & checksum trailer
       else
-      {
-        qsizetype bytesToRemove = endIndex + delimiter.size();
-        (void)m_dataBuffer.read(bytesToRemove);
-      }
+        consume(endIndex + chop);
     }
 
     // Empty frame; move past the finish sequence
     else
     {
-      qsizetype bytesToRemove = endIndex + delimiter.size();
-      (void)m_dataBuffer.read(bytesToRemove);
+      m_skippedFrames.fetch_add(1, std::memory_order_relaxed);
+      consume(endIndex + delimiter.size());
     }
 
     // Increment number of frames read
@@ -366,7 +1033,7 @@ void IO::FrameReader::readEndDelimetedFrames()
  * @brief Reads frames delimited by a start sequence from the buffer.
  *
  * Extracts frames from the circular buffer that are bounded by specified
- * start delimiters. Emits `frameReady` for each valid frame.
+ * start delimiters. Queues each valid frame for publishing.
  */
 void IO::FrameReader::readStartDelimitedFrames()
 {
@@ -382,33 +1049,31 @@ void IO::FrameReader::readStartDelimitedFrames()
     int nextStartIndex = -1;
 
     // Find the first start sequence in the buffer (project mode)
-    startIndex = m_dataBuffer.findPatternKMP(m_startSequence);
+    startIndex = m_dataBuffer.findPatternKMP(m_startScanner);
     if (startIndex == -1)
       break;
 
     // Find the next start sequence after the current one
     nextStartIndex = m_dataBuffer.findPatternKMP(
-        m_startSequence, startIndex + m_startSequence.size());
+        m_nextStartScanner, startIndex + m_startSequence.size());
     if (nextStartIndex == -1 || nextStartIndex == startIndex
         || nextStartIndex < startIndex)
       break;
 
-    // Extract the frame from the buffer
+    // Obtain a zero-copy view of the frame
     qsizetype frameStart = startIndex + m_startSequence.size();
     qsizetype frameLength = nextStartIndex - frameStart;
-    QByteArray frame = m_dataBuffer.peek(frameStart + frameLength)
-                           .mid(frameStart, frameLength);
+    const QByteArray frame = m_dataBuffer.view(frameStart, frameLength);
 
     // Parse frame if not empty
     if (!frame.isEmpty())
-    {
-      Q_EMIT frameReady(frame);
-      (void)m_dataBuffer.read(frameStart + frameLength);
-    }
-
-    // Avoid infinite loops when getting a frame length of 0
+      enqueueFrame(QByteArray(frame.constData(), frame.size()));
     else
-      (void)m_dataBuffer.read(frameStart);
+      m_skippedFrames.fetch_add(1, std::memory_order_relaxed);
+
+    // Move to the next start sequence, which is now the first one
+    consume(nextStartIndex);
+    std::swap(m_startScanner, m_nextStartScanner);
 
     // Increment number of frames read
     ++framesRead;
@@ -421,167 +1086,405 @@ void IO::FrameReader::readStartDelimitedFrames()
  *
  * Extracts frames from the circular buffer that are enclosed by a specified
  * start and end sequence. Validates frames using integrity checks (e.g., CRC)
- * if applicable, and emits `frameReady` for each valid frame.
+ * if applicable, and queues each valid frame for publishing.
  */
 void IO::FrameReader::readStartEndDelimetedFrames()
 {
   // Consume the buffer until no frames are found
   while (true)
   {
-    // Find the first end sequence
-    int finishIndex = m_dataBuffer.findPatternKMP(m_finishSequence);
+    // Find the first end sequence & any start sequence before it in one pass
+    int finishIndex = m_dataBuffer.findDelimiter(m_frameScanner);
     if (finishIndex == -1)
       break;
 
-    // Find the first start sequence and ensure its before the end sequence
-    int startIndex = m_dataBuffer.findPatternKMP(m_startSequence);
+    // Ensure that the start sequence is before the end sequence
+    int startIndex = static_cast<int>(m_frameScanner.markerAt[0]);
     if (startIndex == -1 || startIndex >= finishIndex)
     {
-      (void)m_dataBuffer.read(finishIndex + m_finishSequence.size());
+      m_skippedFrames.fetch_add(1, std::memory_order_relaxed);
+      consume(finishIndex + m_finishSequence.size());
       continue;
     }
 
     // Calculate frame boundaries
     qsizetype frameStart = startIndex + m_startSequence.size();
-    qsizetype frameLength = finishIndex - frameStart;
+    qsizetype frameLength = qMax<qsizetype>(0, finishIndex - frameStart);
 
-    // Extract the frame between start and finish sequences
-    QByteArray frame = m_dataBuffer.peek(frameStart + frameLength)
-                           .mid(frameStart, frameLength);
+    // Obtain a zero-copy view of the frame between start and finish sequences
+    const QByteArray frame = m_dataBuffer.view(frameStart, frameLength);
 
     // Parse the frame if not empty
     if (!frame.isEmpty())
     {
       // Checksum verification & emit frame if valid
       qsizetype chop = 0;
-      auto result = integrityChecks(frame, m_finishSequence, &chop);
+      auto result
+          = integrityChecks(frame, m_finishSequence, finishIndex, &chop);
       if (result == ValidationStatus::FrameOk)
       {
-        Q_EMIT frameReady(frame);
-        qsizetype bytesToRemove = finishIndex + chop;
-        (void)m_dataBuffer.read(bytesToRemove);
+        enqueueFrame(QByteArray(frame.constData(), frame.size()));
+        consume(finishIndex + chop);
       }
 
       // Incomplete data; wait for more data
       else if (result == ValidationStatus::ChecksumIncomplete)
         break;
 
-      // Invalid frame; discard up to the end sequence
+      // Invalid frame; discard up to the end of the checksum trailer
       else
-      {
-        qsizetype bytesToRemove = finishIndex + m_finishSequence.size();
-        (void)m_dataBuffer.read(bytesToRemove);
-      }
+        consume(finishIndex + chop);
     }
 
     // Empty frame; discard up to the end sequence
     else
     {
-      qsizetype bytesToRemove = finishIndex + m_finishSequence.size();
-      (void)m_dataBuffer.read(bytesToRemove);
+      m_skippedFrames.fetch_add(1, std::memory_order_relaxed);
+      consume(finishIndex + m_finishSequence.size());
+    }
+  }
+}
+
+/**
+ * @brief Reads length-prefixed binary frames from the buffer.
+ *
+ * Each frame starts with a sync word, followed by the header bytes and the
+ * length field described by the current `LengthPrefixFormat`. Once the length
+ * field is read, the reader jumps straight to the end of the frame, so payload
+ * bytes are never scanned and may contain any value, including the sync word.
+ *
+ * While in sync, the next frame is expected right after the previous one and
+ * only its sync word is compared. The buffer is searched for a sync word only
+ * after synchronization is lost, which happens when the sync word is missing
+ * or when the length field exceeds the maximum payload length. In the latter
+ * case, only the first byte of the bogus sync word is dropped, so a corrupted
+ * length field delays the stream by at most one maximum-length frame.
+ *
+ * The emitted frame contains everything after the sync word: the header
+ * bytes, the length field and the payload.
+ */
+void IO::FrameReader::readLengthPrefixedFrames()
+{
+  // Obtain the header layout
+  const auto &format = m_lengthPrefix;
+  const auto syncSize = format.syncWord.size();
+  const auto lengthAt = syncSize + format.lengthOffset;
+  const auto headerSize = lengthAt + format.lengthSize;
+
+  // Consume the buffer until no frames are found
+  while (true)
+  {
+    // Check for the sync word at the expected frame boundary
+    const auto sync = compareAt(0, format.syncWord);
+    if (sync < 0)
+      break;
+
+    // Synchronization lost, drop data up to the next sync word
+    if (sync == 0)
+    {
+      if (!m_resynchronizing)
+        m_resyncCount.fetch_add(1, std::memory_order_relaxed);
+
+      m_resynchronizing = true;
+      const auto index = m_dataBuffer.findDelimiter(m_syncWordScanner);
+      if (index == -1)
+      {
+        consume(m_syncWordScanner.scanned);
+        break;
+      }
+
+      consume(index);
+      continue;
+    }
+
+    // Wait for the length field
+    if (m_dataBuffer.size() < headerSize)
+      break;
+
+    // Read the payload length
+    quint64 length = 0;
+    for (int i = 0; i < format.lengthSize; ++i)
+    {
+      const auto byte = format.bigEndian ? i : format.lengthSize - 1 - i;
+      const auto value = static_cast<quint8>(m_dataBuffer[lengthAt + byte]);
+      length = (length << 8) | value;
     }
+
+    // Invalid length, the sync word was part of the payload of another frame
+    if (length > static_cast<quint64>(format.maxLength))
+    {
+      if (!m_resynchronizing)
+        m_resyncCount.fetch_add(1, std::memory_order_relaxed);
+
+      m_resynchronizing = true;
+      consume(1);
+      continue;
+    }
+
+    // Wait for the rest of the frame
+    const auto frameSize = headerSize + static_cast<qsizetype>(length);
+    if (m_dataBuffer.size() < frameSize)
+      break;
+
+    // Obtain a zero-copy view of the frame & emit a deep copy of it
+    const QByteArray frame = m_dataBuffer.view(syncSize, frameSize - syncSize);
+    enqueueFrame(QByteArray(frame.constData(), frame.size()));
+
+    // Move to the next frame
+    m_resynchronizing = false;
+    consume(frameSize);
   }
 }
 
+/**
+ * @brief Reads COBS or SLIP encoded packets from the buffer.
+ *
+ * Both encodings guarantee that the delimiter byte (0x00 for COBS, 0xC0 for
+ * SLIP) never appears inside a packet, so frames are located with a single
+ * byte SIMD search that resumes where the previous call stopped. Each packet
+ * is then decoded straight from the ring buffer into the emitted frame, so
+ * the data is copied exactly once.
+ *
+ * Empty packets (e.g. the leading delimiter that many SLIP senders use to
+ * flush line noise) are skipped. Malformed packets are dropped and counted as
+ * framing errors.
+ */
+void IO::FrameReader::readEncodedFrames()
+{
+  // Select the decoder
+  const auto decode = m_frameDetectionMode == SerialStudio::COBS ? &cobsDecode
+                                                                 : &slipDecode;
+
+  // Consume the buffer until no packets are found
+  while (true)
+  {
+    // Find the next packet delimiter
+    const int endIndex = m_dataBuffer.findDelimiter(m_packetScanner);
+    if (endIndex == -1)
+      break;
+
+    // Decode the packet directly from the buffer
+    if (endIndex > 0)
+    {
+      QByteArray frame;
+      const QByteArray packet = m_dataBuffer.view(0, endIndex);
+      if (!decode(packet, frame))
+        m_framingErrors.fetch_add(1, std::memory_order_relaxed);
+      else if (!frame.isEmpty())
+        enqueueFrame(frame);
+    }
+
+    // Move past the delimiter
+    consume(endIndex + 1);
+  }
+}
+
+/**
+ * @brief Adds an extracted @a frame to the pending batch.
+ *
+ * The frame is timestamped with the arrival time of the data that completed
+ * it. The batch is published right away if it reached its maximum size.
+ */
+void IO::FrameReader::enqueueFrame(const QByteArray &frame)
+{
+  m_batch.append(frame, m_ingressTime);
+  if (m_batch.size() >= kMaxBatchSize)
+    flushFrames();
+}
+
+/**
+ * @brief Publishes the pending batch if its oldest frame reached the batch
+ *        latency bound, otherwise schedules the batch for later.
+ */
+void IO::FrameReader::publishFrames()
+{
+  // Nothing to publish
+  if (m_batch.isEmpty())
+    return;
+
+  // Publish the batch if the oldest frame waited long enough
+  const qint64 latency = m_batchLatency * 1000000LL;
+  const auto age = IO::monotonicTimestamp() - m_batch.timestamps.first();
+  if (age >= latency)
+  {
+    flushFrames();
+    return;
+  }
+
+  // Publish the batch when the latency bound expires
+  m_delayedFrames.store(static_cast<quint64>(m_batch.size()),
+                        std::memory_order_relaxed);
+  if (!m_batchTimer->isActive())
+    m_batchTimer->start(static_cast<int>((latency - age + 999999) / 1000000));
+}
+
+/**
+ * @brief Removes @a bytes from the front of the buffer.
+ *
+ * Keeps the delimiter scanners in sync with the buffer, so that the next
+ * search resumes where the previous one stopped instead of scanning the whole
+ * buffer again.
+ *
+ * @param bytes Number of bytes to discard.
+ */
+void IO::FrameReader::consume(const qsizetype bytes)
+{
+  m_dataBuffer.skip(bytes);
+
+  m_startScanner.consume(bytes);
+  m_frameScanner.consume(bytes);
+  m_finishScanner.consume(bytes);
+  m_nextStartScanner.consume(bytes);
+  m_syncWordScanner.consume(bytes);
+  m_packetScanner.consume(bytes);
+  m_quickPlotScanner.consume(bytes);
+}
+
+/**
+ * @brief Compares the buffered data at @a offset against @a pattern.
+ *
+ * @param offset Position (relative to the start of the buffer) of the first
+ *               byte to compare.
+ * @param pattern The byte sequence to compare against.
+ *
+ * @return 1 if the pattern matches, 0 if it does not, or -1 if the buffered
+ *         data is a prefix of the pattern and more data is needed.
+ */
+int IO::FrameReader::compareAt(qsizetype offset, const QByteArray &pattern)
+{
+  const auto available = qMax<qsizetype>(0, m_dataBuffer.size() - offset);
+  const auto length = qMin(available, pattern.size());
+  for (qsizetype i = 0; i < length; ++i)
+  {
+    if (m_dataBuffer[offset + i] != pattern.at(i))
+      return 0;
+  }
+
+  return length < pattern.size() ? -1 : 1;
+}
+
 /**
  * @brief Performs integrity checks on a frame.
  *
- * Verifies the validity of a frame using CRC checks (CRC-8, CRC-16, or CRC-32)
- * if the appropriate headers are detected in the circular buffer. Updates the
- * number of bytes to be removed from the buffer and returns the validation
- * status.
+ * Verifies the validity of a frame using the checksum trailer (e.g. CRC-16 or
+ * Fletcher-16) located right after the frame delimiter. Only the few bytes of
+ * the trailer are inspected, so the cost of this function does not depend on
+ * how much data is waiting in the buffer.
+ *
+ * In auto-detect mode, the algorithm of the first trailer received is used for
+ * all subsequent frames until the reader is reset. Checksum mismatches and
+ * frames that had to wait for their trailer are counted as statistics.
  *
  * @param frame The frame data to validate.
- * @param bytes A pointer to the number of bytes to remove from the buffer.
+ * @param delimeter The delimiter that ends the frame.
+ * @param delimiterIndex Position of the delimiter in the buffer.
+ * @param bytes A pointer to the number of bytes to remove from the buffer,
+ *              including the delimiter and the checksum trailer.
  * @return The validation status as a `ValidationStatus` enum:
  *         - `FrameOk`: Frame is valid.
- *         - `ChecksumError`: CRC mismatch.
+ *         - `ChecksumError`: CRC mismatch or missing trailer.
  *         - `ChecksumIncomplete`: Not enough data for validation.
  */
 IO::ValidationStatus
 IO::FrameReader::integrityChecks(const QByteArray &frame,
-                                 const QByteArray &delimeter, qsizetype *bytes)
+                                 const QByteArray &delimeter,
+                                 qsizetype delimiterIndex, qsizetype *bytes)
 {
-  // Get finish sequence as byte array
-  auto crc8Header = delimeter + "crc8:";
-  auto crc16Header = delimeter + "crc16:";
-  auto crc32Header = delimeter + "crc32:";
-
-  // Temporary buffer to peek at the required length of data
-  QByteArray cursor = m_dataBuffer.peek(m_dataBuffer.size());
+  // The trailer starts right after the delimiter
+  const auto trailer = delimiterIndex + delimeter.size();
 
-  // Check CRC-8
-  if (cursor.contains(crc8Header))
+  // Detect the checksum algorithm from the first trailer received
+  if (m_checksum == SerialStudio::AutoDetectChecksum)
   {
-    m_enableCrc = true;
-    qsizetype offset = cursor.indexOf(crc8Header) + crc8Header.length() - 1;
+    bool partial = false;
+    for (const auto &format : checksumTrailers())
+    {
+      const auto result = compareAt(trailer, format.header);
+      if (result > 0)
+      {
+        m_checksum = format.algorithm;
+        break;
+      }
 
-    // Check if we have enough data in the buffer
-    if (cursor.size() >= offset + 1)
+      partial |= result < 0;
+    }
+
+    // No trailer (yet), wait only if a partial header was received
+    if (m_checksum == SerialStudio::AutoDetectChecksum)
     {
-      *bytes += crc8Header.length() + 1;
-      quint8 crc = static_cast<quint8>(cursor.at(offset + 1));
+      if (partial && trailer < m_dataBuffer.size())
+      {
+        if (!m_awaitingChecksum)
+          m_incompleteChecksums.fetch_add(1, std::memory_order_relaxed);
 
-      if (crc8(frame.data(), frame.length()) == crc)
-        return ValidationStatus::FrameOk;
-      else
-        return ValidationStatus::ChecksumError;
+        m_awaitingChecksum = true;
+        return ValidationStatus::ChecksumIncomplete;
+      }
+
+      m_awaitingChecksum = false;
+      *bytes += delimeter.length();
+      return ValidationStatus::FrameOk;
     }
   }
 
-  // Check CRC-16
-  else if (cursor.contains(crc16Header))
+  // Obtain the trailer format of the selected algorithm
+  const ChecksumTrailer *format = nullptr;
+  for (const auto &t : checksumTrailers())
   {
-    m_enableCrc = true;
-    qsizetype offset = cursor.indexOf(crc16Header) + crc16Header.length() - 1;
-
-    // Check if we have enough data in the buffer
-    if (cursor.size() >= offset + 2)
+    if (t.algorithm == m_checksum)
     {
-      *bytes += crc16Header.length() + 2;
-
-      quint8 a = static_cast<quint8>(cursor.at(offset + 1));
-      quint8 b = static_cast<quint8>(cursor.at(offset + 2));
-      quint16 crc = (a << 8) | b;
-
-      if (crc16(frame.data(), frame.length()) == crc)
-        return ValidationStatus::FrameOk;
-      else
-        return ValidationStatus::ChecksumError;
+      format = &t;
+      break;
     }
   }
 
-  // Check CRC-32
-  else if (cursor.contains(crc32Header))
+  // Frames do not carry a checksum
+  if (!format)
   {
-    m_enableCrc = true;
-    qsizetype offset = cursor.indexOf(crc32Header) + crc32Header.length() - 1;
+    *bytes += delimeter.length();
+    return ValidationStatus::FrameOk;
+  }
 
-    // Check if we have enough data in the buffer
-    if (cursor.size() >= offset + 4)
-    {
-      *bytes += crc32Header.length() + 4;
+  // Obtain trailer header & checksum length
+  const auto length = format->length;
+  const auto *header = &format->header;
 
-      quint8 a = static_cast<quint8>(cursor.at(offset + 1));
-      quint8 b = static_cast<quint8>(cursor.at(offset + 2));
-      quint8 c = static_cast<quint8>(cursor.at(offset + 3));
-      quint8 d = static_cast<quint8>(cursor.at(offset + 4));
-      quint32 crc = (a << 24) | (b << 16) | (c << 8) | d;
+  // Check that the trailer is complete
+  const auto result = compareAt(trailer, *header);
+  const auto offset = trailer + header->size();
+  if (result < 0 || (result > 0 && m_dataBuffer.size() < offset + length))
+  {
+    if (!m_awaitingChecksum)
+      m_incompleteChecksums.fetch_add(1, std::memory_order_relaxed);
 
-      if (crc32(frame.data(), frame.length()) == crc)
-        return ValidationStatus::FrameOk;
-      else
-        return ValidationStatus::ChecksumError;
-    }
+    m_awaitingChecksum = true;
+    return ValidationStatus::ChecksumIncomplete;
   }
 
-  // Buffer does not contain CRC code
-  else if (!m_enableCrc)
+  // Trailer missing, reject the frame
+  m_awaitingChecksum = false;
+  if (result == 0)
   {
     *bytes += delimeter.length();
-    return ValidationStatus::FrameOk;
+    m_checksumErrors.fetch_add(1, std::memory_order_relaxed);
+    return ValidationStatus::ChecksumError;
+  }
+
+  // Read the checksum in big-endian byte order
+  quint32 crc = 0;
+  for (qsizetype i = 0; i < length; ++i)
+    crc = (crc << 8) | static_cast<quint8>(m_dataBuffer[offset + i]);
+
+  // Calculate the checksum of the frame
+  const auto expected = computeChecksum(m_checksum, frame);
+
+  // Validate the frame, skip the trailer in any case
+  *bytes += delimeter.length() + header->size() + length;
+  if (expected != crc)
+  {
+    m_checksumErrors.fetch_add(1, std::memory_order_relaxed);
+    return ValidationStatus::ChecksumError;
   }
 
-  // Checksum data incomplete
-  return ValidationStatus::ChecksumIncomplete;
+  return ValidationStatus::FrameOk;
 }
@@ -26,7 +26,11 @@
 #include <QObject>
 #include <QByteArray>
 
+#include <atomic>
+
 #include "SerialStudio.h"
+#include "IO/FrameBatch.h"
+#include "IO/FrameQueue.h"
 #include "IO/CircularBuffer.h"
 
 namespace IO
@@ -38,6 +42,70 @@ enum class ValidationStatus
   ChecksumIncomplete
 };
 
+/**
+ * @brief Header layout of length-prefixed binary frames.
+ *
+ * Each frame starts with a fixed sync word, followed by @c lengthOffset header
+ * bytes and a @c lengthSize byte unsigned integer with the number of payload
+ * bytes that come after the length field.
+ */
+struct LengthPrefixFormat
+{
+  QByteArray syncWord;     /**< Bytes that mark the start of a frame. */
+  int lengthOffset = 0;    /**< Bytes between sync word and length field. */
+  int lengthSize = 1;      /**< Width of the length field (1, 2 or 4). */
+  bool bigEndian = true;   /**< Byte order of the length field. */
+  int maxLength = 1024;    /**< Largest payload length accepted. */
+
+  bool operator==(const LengthPrefixFormat &other) const
+  {
+    return syncWord == other.syncWord && lengthOffset == other.lengthOffset
+           && lengthSize == other.lengthSize && bigEndian == other.bigEndian
+           && maxLength == other.maxLength;
+  }
+
+  bool operator!=(const LengthPrefixFormat &other) const
+  {
+    return !(*this == other);
+  }
+};
+
+/**
+ * @brief Snapshot of the counters of one or more frame readers.
+ *
+ * All counters are cumulative since the last reset, except @c queuedFrames,
+ * which is the number of frames waiting in the output queue, or held back by
+ * the batch latency, when the snapshot was taken.
+ */
+struct FrameReaderStatistics
+{
+  quint64 bytesReceived = 0;       /**< Bytes received from the device. */
+  quint64 framesExtracted = 0;     /**< Frames extracted from the data. */
+  quint64 checksumErrors = 0;      /**< Frames with an invalid checksum. */
+  quint64 skippedFrames = 0;       /**< Empty or unterminated frames. */
+  quint64 framingErrors = 0;       /**< Malformed COBS/SLIP packets. */
+  quint64 resyncCount = 0;         /**< Length-prefix resynchronizations. */
+  quint64 queuedFrames = 0;        /**< Frames not collected yet. */
+  quint64 droppedFrames = 0;       /**< Frames dropped by the queue. */
+  quint64 droppedBytes = 0;        /**< Payload bytes dropped by the queue. */
+  quint64 ingressDroppedBytes = 0; /**< Bytes dropped before framing. */
+
+  FrameReaderStatistics &operator+=(const FrameReaderStatistics &other)
+  {
+    bytesReceived += other.bytesReceived;
+    framesExtracted += other.framesExtracted;
+    checksumErrors += other.checksumErrors;
+    skippedFrames += other.skippedFrames;
+    framingErrors += other.framingErrors;
+    resyncCount += other.resyncCount;
+    queuedFrames += other.queuedFrames;
+    droppedFrames += other.droppedFrames;
+    droppedBytes += other.droppedBytes;
+    ingressDroppedBytes += other.ingressDroppedBytes;
+    return *this;
+  }
+};
+
 /**
  * @class IO::FrameReader
  * @brief Multithreaded frame reader for detecting and processing streamed data.
@@ -46,13 +114,19 @@ enum class ValidationStatus
  * and end sequences or delimiters. Supports multiple modes for flexible data
  * handling, such as quick plotting, JSON extraction, and project-specific
  * parsing.
+ *
+ * Extracted frames are published in batches, at most one per wake-up of the
+ * worker thread, or later if a batch latency is configured. Batches go through
+ * a bounded `FrameQueue`, consumers are notified with `framesReady()` and then
+ * collect all pending frames with `takeFrames()`.
  */
 class FrameReader : public QObject
 {
   Q_OBJECT
 
 signals:
-  void frameReady(const QByteArray &frame);
+  void framesReady();
+  void dataProcessed(const qsizetype bytes);
   void dataReceived(const QByteArray &data);
 
 public:
@@ -64,28 +138,80 @@ public:
   [[nodiscard]] const QByteArray &startSequence() const;
   [[nodiscard]] const QByteArray &finishSequence() const;
 
+  [[nodiscard]] quint64 checksumErrors() const;
+  [[nodiscard]] quint64 incompleteChecksums() const;
+  [[nodiscard]] SerialStudio::ChecksumAlgorithm checksumAlgorithm() const;
+
+  [[nodiscard]] int batchLatency() const;
+  [[nodiscard]] quint64 resyncCount() const;
+  [[nodiscard]] quint64 framingErrors() const;
+  [[nodiscard]] const LengthPrefixFormat &lengthPrefixFormat() const;
+
+  [[nodiscard]] quint64 droppedBytes() const;
+  [[nodiscard]] quint64 droppedFrames() const;
+  [[nodiscard]] quint64 ingressDroppedBytes() const;
+  [[nodiscard]] quint64 bytesReceived() const;
+  [[nodiscard]] quint64 framesExtracted() const;
+  [[nodiscard]] quint64 skippedFrames() const;
+  [[nodiscard]] FrameReaderStatistics statistics() const;
+  [[nodiscard]] IO::FrameBatch takeFrames();
+
 public slots:
   void reset();
   void setupExternalConnections();
+  void setBatchLatency(const int milliseconds);
+  void setQueueCapacity(const int frames);
   void processData(const QByteArray &data);
+  void processDatagrams(const IO::DatagramBatch &batch);
   void setStartSequence(const QString &start);
   void setFinishSequence(const QString &finish);
   void setOperationMode(const SerialStudio::OperationMode mode);
   void setFrameDetectionMode(const SerialStudio::FrameDetection mode);
+  void setChecksumAlgorithm(const SerialStudio::ChecksumAlgorithm algorithm);
+  void setLengthPrefixFormat(const IO::LengthPrefixFormat &format);
+  void setBackpressurePolicy(const SerialStudio::BackpressurePolicy policy);
 
 private slots:
   void readFrames();
+  void flushFrames();
 
 private:
   void readEndDelimetedFrames();
   void readStartDelimitedFrames();
   void readStartEndDelimetedFrames();
+  void readLengthPrefixedFrames();
+  void readEncodedFrames();
+  void publishFrames();
+  void acknowledgeData();
+  void consume(const qsizetype bytes);
+  void enqueueFrame(const QByteArray &frame);
+  int compareAt(qsizetype offset, const QByteArray &pattern);
   ValidationStatus integrityChecks(const QByteArray &frame,
                                    const QByteArray &delimeter,
-                                   qsizetype *bytes);
+                                   qsizetype delimiterIndex, qsizetype *bytes);
 
 private:
-  bool m_enableCrc;
+  int m_batchLatency;
+  qint64 m_ingressTime;
+  qsizetype m_unprocessedBytes;
+  FrameBatch m_batch;
+  FrameQueue m_queue;
+  QTimer *m_batchTimer;
+
+  bool m_resynchronizing;
+  bool m_awaitingChecksum;
+  SerialStudio::ChecksumAlgorithm m_checksum;
+  SerialStudio::ChecksumAlgorithm m_checksumAlgorithm;
+
+  std::atomic<quint64> m_checksumErrors;
+  std::atomic<quint64> m_incompleteChecksums;
+  std::atomic<quint64> m_resyncCount;
+  std::atomic<quint64> m_framingErrors;
+  std::atomic<quint64> m_ingressDroppedBytes;
+  std::atomic<quint64> m_bytesReceived;
+  std::atomic<quint64> m_framesExtracted;
+  std::atomic<quint64> m_skippedFrames;
+  std::atomic<quint64> m_delayedFrames;
 
   SerialStudio::OperationMode m_operationMode;
   SerialStudio::FrameDetection m_frameDetectionMode;
@@ -94,6 +220,14 @@ private:
 
   QByteArray m_startSequence;
   QByteArray m_finishSequence;
-  QList<QByteArray> m_quickPlotEndSequences;
+  LengthPrefixFormat m_lengthPrefix;
+
+  KMPScanner<QByteArray> m_startScanner;
+  KMPScanner<QByteArray> m_nextStartScanner;
+  DelimiterScanner<QByteArray> m_frameScanner;
+  DelimiterScanner<QByteArray> m_finishScanner;
+  DelimiterScanner<QByteArray> m_syncWordScanner;
+  DelimiterScanner<QByteArray> m_packetScanner;
+  DelimiterScanner<QByteArray> m_quickPlotScanner;
 };
 } // namespace IO
@@ -21,9 +21,15 @@
 
 #pragma once
 
+#include <QThread>
 #include <QObject>
 #include <QIODevice>
 
+#include <atomic>
+#include <type_traits>
+
+#include "IO/FrameBatch.h"
+
 namespace IO
 {
 /**
@@ -36,6 +42,16 @@ namespace IO
  *
  * Signals are available for configuration changes, data transmission, and data
  * reception.
+ *
+ * Drivers may move their underlying device objects (sockets, serial ports...)
+ * to the I/O thread owned by @c IO::Manager. In that case, received data is
+ * emitted directly from the I/O thread and reaches the frame reader through a
+ * single queued connection, while the driver object itself stays on the GUI
+ * thread to expose its properties to QML.
+ *
+ * Such drivers record the state of their device with `setDeviceState()` from
+ * the I/O thread, so that `isOpen()`, `isReadable()` & `isWritable()` can be
+ * answered from any thread without waiting for the I/O thread.
  */
 class HAL_Driver : public QObject
 {
@@ -45,6 +61,7 @@ signals:
   void configurationChanged();
   void dataSent(const QByteArray &data);
   void dataReceived(const QByteArray &data);
+  void datagramsReceived(const IO::DatagramBatch &batch);
 
 public:
   /**
@@ -59,12 +76,124 @@ public:
   [[nodiscard]] virtual quint64 write(const QByteArray &data) = 0;
   [[nodiscard]] virtual bool open(const QIODevice::OpenMode mode) = 0;
 
+  /**
+   * @brief Sets the thread in which the driver should run its device I/O.
+   */
+  void setIoThread(QThread *thread) { m_ioThread = thread; }
+
 protected:
-  void processData(const QByteArray &data)
+  /**
+   * @brief Returns the I/O thread, or the driver's own thread if none is set.
+   */
+  [[nodiscard]] QThread *ioThread() const
+  {
+    return m_ioThread ? m_ioThread : thread();
+  }
+
+  /**
+   * @brief Runs @a function in the thread that owns @a device and returns
+   *        its result.
+   *
+   * The call is direct when the caller already lives in the device thread (or
+   * when that thread is not running, e.g. during shutdown), otherwise the
+   * calling thread blocks until the device thread has executed it.
+   */
+  template<typename Function>
+  static auto invokeOnDevice(const QObject *device, Function function)
+      -> decltype(function())
+  {
+    using Result = decltype(function());
+
+    auto *deviceThread = device->thread();
+    if (deviceThread == QThread::currentThread() || !deviceThread->isRunning())
+      return function();
+
+    auto *context = const_cast<QObject *>(device);
+    if constexpr (std::is_void_v<Result>)
+      QMetaObject::invokeMethod(context, function,
+                                Qt::BlockingQueuedConnection);
+
+    else
+    {
+      Result result{};
+      QMetaObject::invokeMethod(
+          context, [&] { result = function(); }, Qt::BlockingQueuedConnection);
+      return result;
+    }
+  }
+
+  /**
+   * @brief Records whether the given @a device is open, readable & writable.
+   *
+   * Should be called from the device thread whenever the device is opened,
+   * closed or fails. A @c nullptr device, or @a connected set to @c false,
+   * records the device as closed.
+   */
+  void setDeviceState(const QIODevice *device, const bool connected = true)
+  {
+    int state = 0;
+    if (device && connected && device->isOpen())
+    {
+      state = kDeviceOpen;
+      if (device->isReadable())
+        state |= kDeviceReadable;
+      if (device->isWritable())
+        state |= kDeviceWritable;
+    }
+
+    m_deviceState.store(state, std::memory_order_release);
+  }
+
+  /**
+   * @brief Returns @c true if the device was last recorded as open.
+   */
+  [[nodiscard]] bool deviceOpen() const
+  {
+    return m_deviceState.load(std::memory_order_acquire) & kDeviceOpen;
+  }
+
+  /**
+   * @brief Returns @c true if the device was last recorded as readable.
+   */
+  [[nodiscard]] bool deviceReadable() const
+  {
+    return m_deviceState.load(std::memory_order_acquire) & kDeviceReadable;
+  }
+
+  /**
+   * @brief Returns @c true if the device was last recorded as writable.
+   */
+  [[nodiscard]] bool deviceWritable() const
+  {
+    return m_deviceState.load(std::memory_order_acquire) & kDeviceWritable;
+  }
+
+  /**
+   * @brief Publishes data read from the device.
+   *
+   * May be called from any thread, the receiving side is expected to use a
+   * queued connection.
+   */
+  void processData(const QByteArray &data) { Q_EMIT dataReceived(data); }
+
+  /**
+   * @brief Publishes a group of datagrams read from the device at once.
+   *
+   * Same threading rules as `processData()`. Used by message-oriented drivers
+   * so that datagram boundaries are kept and only one event is posted for the
+   * whole batch.
+   */
+  void processDatagrams(const IO::DatagramBatch &batch)
   {
-    QByteArray dataCopy(data);
-    QMetaObject::invokeMethod(
-        this, [=] { Q_EMIT dataReceived(dataCopy); }, Qt::QueuedConnection);
+    Q_EMIT datagramsReceived(batch);
   }
+
+private:
+  static constexpr int kDeviceOpen = 0x01;
+  static constexpr int kDeviceReadable = 0x02;
+  static constexpr int kDeviceWritable = 0x04;
+
+  QThread *m_ioThread = nullptr;
+  std::atomic<int> m_deviceState{0};
 };
 } // namespace IO
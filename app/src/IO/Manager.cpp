@@ -21,10 +21,13 @@
 
 #include "IO/Manager.h"
 #include "IO/Drivers/UART.h"
+#include "IO/Drivers/Replay.h"
 #include "IO/Drivers/Network.h"
 #include "IO/Drivers/BluetoothLE.h"
 
 #include "Misc/Translator.h"
+#include "Misc/TimerEvents.h"
+#include "Misc/ThreadScheduler.h"
 
 #include <QApplication>
 
@@ -65,8 +68,13 @@ static QString ADD_ESCAPE_SEQUENCES(const QString &str)
  */
 IO::Manager::Manager()
   : m_paused(false)
+  , m_batchLatency(0)
+  , m_queueCapacity(4096)
+  , m_backpressurePolicy(SerialStudio::Block)
   , m_writeEnabled(true)
   , m_driver(nullptr)
+  , m_framesHeld(false)
+  , m_pendingSources(0)
   , m_startSequence(QStringLiteral("/*"))
   , m_finishSequence(QStringLiteral("*/"))
 {
@@ -86,13 +94,29 @@ IO::Manager::Manager()
 
   // Avoid crashing the app when quitting
   connect(qApp, &QApplication::aboutToQuit, this, [=] {
+    if (m_driver)
+      m_driver->close();
+
+    qDeleteAll(m_sources);
+    m_sources.clear();
+
+    m_ioThread.quit();
+    if (!m_ioThread.wait(100))
+      m_ioThread.terminate();
+
     disconnect(&m_frameReader);
     m_workerThread.quit();
     if (!m_workerThread.wait(100))
       m_workerThread.terminate();
   });
 
-  // Start the worker thread
+  // Start the device I/O & frame parser threads
+  auto &scheduler = Misc::ThreadScheduler::instance();
+  m_ioThread.setObjectName(QStringLiteral("Device I/O"));
+  m_workerThread.setObjectName(QStringLiteral("Frame Reader"));
+  scheduler.registerThread(&m_ioThread, Misc::ThreadScheduler::DeviceIO);
+  scheduler.registerThread(&m_workerThread, Misc::ThreadScheduler::Framing);
+  m_ioThread.start(QThread::TimeCriticalPriority);
   m_workerThread.start(QThread::HighestPriority);
 
   // Set default data interface to serial port
@@ -225,6 +249,102 @@ const QString &IO::Manager::startSequence() const
   return m_startSequence;
 }
 
+/**
+ * @brief Retrieves the maximum time (in milliseconds) that received frames are
+ *        held back by the frame reader, so that they can be delivered to the
+ *        rest of the application in larger batches.
+ *
+ * @return The batch latency bound, zero if frames are delivered as soon as
+ *         the data that completes them is processed.
+ */
+int IO::Manager::batchLatency() const
+{
+  return m_batchLatency;
+}
+
+/**
+ * @brief Retrieves the maximum number of frames that may wait between the
+ *        frame reader and the rest of the application.
+ */
+int IO::Manager::queueCapacity() const
+{
+  return m_queueCapacity;
+}
+
+/**
+ * @brief Retrieves the number of frame payload bytes discarded between the
+ *        frame readers and the rest of the application since connecting.
+ */
+quint64 IO::Manager::droppedBytes() const
+{
+  auto bytes = m_frameReader.droppedBytes();
+  for (auto *source : m_sources)
+    bytes += source->frameReader().droppedBytes();
+
+  return bytes;
+}
+
+/**
+ * @brief Retrieves the number of frames discarded between the frame readers
+ *        and the rest of the application since connecting.
+ */
+quint64 IO::Manager::droppedFrames() const
+{
+  auto frames = m_frameReader.droppedFrames();
+  for (auto *source : m_sources)
+    frames += source->frameReader().droppedFrames();
+
+  return frames;
+}
+
+/**
+ * @brief Retrieves the number of received bytes that were discarded before
+ *        frame extraction since connecting.
+ */
+quint64 IO::Manager::ingressDroppedBytes() const
+{
+  auto bytes = m_frameReader.ingressDroppedBytes();
+  for (auto *source : m_sources)
+    bytes += source->frameReader().ingressDroppedBytes();
+
+  return bytes;
+}
+
+/**
+ * @brief Retrieves the combined counters of the frame readers of the main
+ *        device & of all the additional data sources since connecting.
+ */
+IO::FrameReaderStatistics IO::Manager::statistics() const
+{
+  auto stats = m_frameReader.statistics();
+  for (auto *source : m_sources)
+    stats += source->frameReader().statistics();
+
+  return stats;
+}
+
+/**
+ * @brief Retrieves the names of the available backpressure policies, in the
+ *        same order as the `SerialStudio::BackpressurePolicy` enum.
+ */
+QStringList IO::Manager::backpressurePolicies() const
+{
+  QStringList list;
+  list.append(tr("Block"));
+  list.append(tr("Drop Oldest"));
+  list.append(tr("Keep Latest"));
+  return list;
+}
+
+/**
+ * @brief Retrieves what happens to new frames when the rest of the application
+ *        cannot keep up with the frame reader.
+ */
+SerialStudio::BackpressurePolicy IO::Manager::backpressurePolicy() const
+{
+  return m_backpressurePolicy;
+}
+
 /**
  * @brief Retrieves the finish sequence used for frame detection.
  *
@@ -241,7 +361,7 @@ const QString &IO::Manager::finishSequence() const
  * @brief Retrieves a list of available bus types.
  *
  * Provides a list of all supported communication mediums, including Serial,
- * Network, and Bluetooth LE.
+ * Network, Bluetooth LE and the replay of raw data captures.
  *
  * @return A list of available bus types as strings.
  */
@@ -251,6 +371,7 @@ QStringList IO::Manager::availableBuses() const
   list.append(tr("UART/COM"));
   list.append(tr("Network Socket"));
   list.append(tr("Bluetooth LE"));
+  list.append(tr("Replay Capture"));
 #ifdef USE_QT_COMMERCIAL
   // Comment these ports for v3.0.7 release...I will add support for these
   // IO modules later, right now I need testing data to not drown in issues
@@ -308,8 +429,9 @@ void IO::Manager::toggleConnection()
  * @brief Connects to the configured device.
  *
  * Attempts to open the device in the appropriate mode (read-only or read-write)
- * and sets up the `FrameReader` to process incoming data. Emits a signal to
- * update the connection state.
+ * and sets up the `FrameReader` to process incoming data. The additional data
+ * sources of the project are opened together with the main device. Emits a
+ * signal to update the connection state.
  */
 void IO::Manager::connectDevice()
 {
@@ -330,13 +452,11 @@ void IO::Manager::connectDevice()
 
       connect(driver(), &IO::HAL_Driver::dataReceived, &m_frameReader,
               &FrameReader::processData, Qt::QueuedConnection);
+      connect(driver(), &IO::HAL_Driver::datagramsReceived, &m_frameReader,
+              &FrameReader::processDatagrams, Qt::QueuedConnection);
       connect(
-          &m_frameReader, &IO::FrameReader::frameReady, this,
-          [this](const QByteArray &frame) {
-            if (!paused())
-              Q_EMIT frameReceived(frame);
-          },
-          Qt::QueuedConnection);
+          &m_frameReader, &IO::FrameReader::framesReady, this,
+          [this] { notifyFramesReady(0); }, Qt::DirectConnection);
       connect(
           &m_frameReader, &IO::FrameReader::dataReceived, this,
           [this](const QByteArray &data) {
@@ -344,6 +464,18 @@ void IO::Manager::connectDevice()
               Q_EMIT dataReceived(data);
           },
           Qt::QueuedConnection);
+
+      // Let capture replays know how much data the frame reader processed
+      if (driver() == &Drivers::Replay::instance())
+        connect(
+            &m_frameReader, &IO::FrameReader::dataProcessed, this,
+            [](const qsizetype bytes) {
+              Drivers::Replay::instance().acknowledge(bytes);
+            },
+            Qt::DirectConnection);
+
+      // Open the additional data sources
+      openSources(mode);
     }
 
     // Error opening the device
@@ -359,16 +491,17 @@ void IO::Manager::connectDevice()
 /**
  * @brief Disconnects from the current device.
  *
- * Closes the connection to the device, clears the frame reader buffer, and
- * disconnects any associated signals. Emits signals to update the UI and
- * reflect the new state.
+ * Closes the connection to the device and the additional data sources,
+ * clears the frame reader buffer, and disconnects any associated signals.
+ * Emits signals to update the UI and reflect the new state.
  */
 void IO::Manager::disconnectDevice()
 {
   if (driver())
   {
-    // Close driver device
+    // Close driver device & additional data sources
     driver()->close();
+    closeSources();
     setPaused(false);
 
     // Disconnect frame reader
@@ -377,9 +510,11 @@ void IO::Manager::disconnectDevice()
       QMetaObject::invokeMethod(&m_frameReader, &FrameReader::reset,
                                 Qt::BlockingQueuedConnection);
 
-      disconnect(&m_frameReader);
+      disconnect(&m_frameReader, nullptr, this, nullptr);
       disconnect(driver(), &IO::HAL_Driver::dataReceived, &m_frameReader,
                  &FrameReader::processData);
+      disconnect(driver(), &IO::HAL_Driver::datagramsReceived, &m_frameReader,
+                 &FrameReader::processDatagrams);
     }
 
     // Enqueue a UI update request
@@ -404,6 +539,15 @@ void IO::Manager::setupExternalConnections()
   // Update the bus list when the language is changed
   connect(&Misc::Translator::instance(), &Misc::Translator::languageChanged,
           this, &IO::Manager::busListChanged);
+  connect(&Misc::Translator::instance(), &Misc::Translator::languageChanged,
+          this, &IO::Manager::backpressurePolicyChanged);
+
+  // Refresh the drop counters in the user interface
+  connect(&Misc::TimerEvents::instance(), &Misc::TimerEvents::timeout1Hz, this,
+          [=] {
+            if (isConnected())
+              Q_EMIT dropCountersChanged();
+          });
 
   // Update the frame reader parameters automatically
   QMetaObject::invokeMethod(&m_frameReader,
@@ -421,6 +565,26 @@ void IO::Manager::setPaused(const bool paused)
   Q_EMIT pausedChanged();
 }
 
+/**
+ * @brief Stops or resumes collecting frames from the frame readers.
+ *
+ * Called by consumers of `framesReceived()` that cannot keep up with the
+ * incoming frames. While frames are held, they stay in the queues of the
+ * frame readers, which block or drop frames according to the backpressure
+ * policy, instead of being discarded further down the pipeline.
+ */
+void IO::Manager::setFramesHeld(const bool held)
+{
+  if (m_framesHeld == held)
+    return;
+
+  // Collect the frames that were flagged while they were held
+  m_framesHeld = held;
+  if (!held && m_pendingSources.load() != 0)
+    QMetaObject::invokeMethod(this, &IO::Manager::collectFrames,
+                              Qt::QueuedConnection);
+}
+
 /**
  * @brief Enables or disables write functionality.
  *
@@ -435,11 +599,65 @@ void IO::Manager::setWriteEnabled(const bool enabled)
   Q_EMIT writeEnabledChanged();
 }
 
+/**
+ * @brief Changes the maximum time that received frames may be held back in
+ *        order to deliver them in larger batches.
+ *
+ * @param milliseconds The batch latency bound, zero to deliver frames as soon
+ *                     as the data that completes them is processed.
+ */
+void IO::Manager::setBatchLatency(const int milliseconds)
+{
+  m_batchLatency = qBound(0, milliseconds, 1000);
+
+  if (m_workerThread.isRunning())
+    QMetaObject::invokeMethod(
+        &m_frameReader, [=] { m_frameReader.setBatchLatency(m_batchLatency); },
+        Qt::QueuedConnection);
+
+  for (auto *source : std::as_const(m_sources))
+    configureFrameReader(&source->frameReader());
+
+  Q_EMIT batchLatencyChanged();
+}
+
+/**
+ * @brief Changes the maximum number of frames that may wait between the frame
+ *        reader and the rest of the application.
+ *
+ * @param frames The queue capacity, limited to the 16-65536 range.
+ */
+void IO::Manager::setQueueCapacity(const int frames)
+{
+  m_queueCapacity = qBound(16, frames, 65536);
+  m_frameReader.setQueueCapacity(m_queueCapacity);
+  for (auto *source : std::as_const(m_sources))
+    source->frameReader().setQueueCapacity(m_queueCapacity);
+  Q_EMIT queueCapacityChanged();
+}
+
+/**
+ * @brief Changes what happens to new frames when the rest of the application
+ *        cannot keep up with the frame reader.
+ *
+ * @param policy Block the frame reader, drop the oldest queued frames or only
+ *               keep the most recent one.
+ */
+void IO::Manager::setBackpressurePolicy(
+    const SerialStudio::BackpressurePolicy policy)
+{
+  m_backpressurePolicy = policy;
+  m_frameReader.setBackpressurePolicy(policy);
+  for (auto *source : std::as_const(m_sources))
+    source->frameReader().setBackpressurePolicy(policy);
+  Q_EMIT backpressurePolicyChanged();
+}
+
 /**
  * @brief Processes a received payload.
  *
  * Invokes signals to notify about the received raw data and parsed frame in a
- * thread-safe manner.
+ * thread-safe manner. The payload is delivered as a batch with a single frame.
  *
  * @param payload The data payload to process.
  */
@@ -447,12 +665,13 @@ void IO::Manager::processPayload(const QByteArray &payload)
 {
   if (!payload.isEmpty())
   {
-    QByteArray copy = payload;
+    FrameBatch batch;
+    batch.append(payload, IO::monotonicTimestamp());
     QMetaObject::invokeMethod(
         this,
         [=] {
-          Q_EMIT dataReceived(copy);
-          Q_EMIT frameReceived(copy);
+          Q_EMIT dataReceived(payload);
+          Q_EMIT framesReceived(batch);
         },
         Qt::QueuedConnection);
   }
@@ -518,6 +737,7 @@ void IO::Manager::setFinishSequence(const QString &sequence)
  * - `SerialStudio::BusType::Serial`: Serial communication.
  * - `SerialStudio::BusType::Network`: Network-based communication.
  * - `SerialStudio::BusType::BluetoothLE`: Bluetooth Low Energy communication.
+ * - `SerialStudio::BusType::Replay`: Replay of a raw data capture.
  *
  * @param driver The new bus type as a `SerialStudio::BusType` enum.
  */
@@ -551,6 +771,10 @@ void IO::Manager::setBusType(const SerialStudio::BusType &driver)
     }
   }
 
+  // Replay a raw data capture
+  else if (busType() == SerialStudio::BusType::Replay)
+    setDriver(static_cast<HAL_Driver *>(&(Drivers::Replay::instance())));
+
   // Invalid driver
   else
     setDriver(nullptr);
@@ -559,6 +783,151 @@ void IO::Manager::setBusType(const SerialStudio::BusType &driver)
   Q_EMIT busTypeChanged();
 }
 
+/**
+ * @brief Replaces the additional data sources of the project.
+ *
+ * Current sources are closed and destroyed. A source object, with its own
+ * driver instance and frame reader thread, is created for each entry of
+ * @a sources. If the main device is connected, the new sources are opened
+ * right away.
+ *
+ * At most 63 additional sources are supported, one per bit of the pending
+ * frames mask (the main device uses the first bit).
+ *
+ * @param sources Settings of the additional sources, in project order.
+ */
+void IO::Manager::setSources(const QVector<IO::SourceConfig> &sources)
+{
+  // Nothing to do
+  if (m_sources.isEmpty() && sources.isEmpty())
+    return;
+
+  // Destroy current sources
+  closeSources();
+  qDeleteAll(m_sources);
+  m_sources.clear();
+
+  // Create new sources
+  const auto count = qMin<qsizetype>(sources.count(), 63);
+  for (qsizetype i = 0; i < count; ++i)
+  {
+    auto config = sources.at(i);
+    config.frameEnd = ADD_ESCAPE_SEQUENCES(config.frameEnd);
+    config.frameStart = ADD_ESCAPE_SEQUENCES(config.frameStart);
+
+    auto *source = new Source(static_cast<int>(i) + 1, config, this);
+    configureFrameReader(&source->frameReader());
+    m_sources.append(source);
+  }
+
+  // Open the sources if the main device is already connected
+  if (isConnected())
+    openSources(m_writeEnabled ? QIODevice::ReadWrite : QIODevice::ReadOnly);
+}
+
+/**
+ * @brief Opens the additional data sources and forwards their frames.
+ *
+ * A source that cannot be opened is skipped, the rest of the sources and the
+ * main device keep streaming.
+ */
+void IO::Manager::openSources(const QIODevice::OpenMode mode)
+{
+  for (auto *source : std::as_const(m_sources))
+  {
+    const auto id = source->id();
+    connect(
+        &source->frameReader(), &IO::FrameReader::framesReady, this,
+        [this, id] { notifyFramesReady(id); }, Qt::DirectConnection);
+
+    if (!source->open(&m_ioThread, mode))
+      qWarning() << "Cannot open data source" << id << source->config().title;
+  }
+}
+
+/**
+ * @brief Closes the additional data sources and discards their pending
+ *        frames.
+ */
+void IO::Manager::closeSources()
+{
+  for (auto *source : std::as_const(m_sources))
+  {
+    disconnect(&source->frameReader(), nullptr, this, nullptr);
+    source->close();
+  }
+}
+
+/**
+ * @brief Flags the given frame @a source as having frames pending.
+ *
+ * Called from the frame reader threads when their output queue stops being
+ * empty. Only the first source that flags an empty mask posts an event to the
+ * GUI thread, the rest of the sources are collected by that same event.
+ *
+ * @note This function is thread-safe and lock-free.
+ */
+void IO::Manager::notifyFramesReady(const int source)
+{
+  const auto bit = quint64(1) << source;
+  const auto previous = m_pendingSources.fetch_or(bit);
+  if (previous == 0)
+    QMetaObject::invokeMethod(this, &IO::Manager::collectFrames,
+                              Qt::QueuedConnection);
+}
+
+/**
+ * @brief Takes the pending frames of every flagged source and publishes them,
+ *        one batch per source.
+ *
+ * The mask is cleared before the queues are drained, so frames queued during
+ * the drain are either collected now or flag the source again. While frames
+ * are held, the mask is left untouched and the sources are collected once
+ * they are released.
+ */
+void IO::Manager::collectFrames()
+{
+  if (m_framesHeld)
+    return;
+
+  auto pending = m_pendingSources.exchange(0);
+  while (pending != 0)
+  {
+    // Obtain the source with the lowest number & clear its flag
+    const auto id = static_cast<int>(qCountTrailingZeroBits(pending));
+    pending &= pending - 1;
+
+    // Obtain the frame reader of the source
+    FrameReader *reader = nullptr;
+    if (id == 0)
+      reader = &m_frameReader;
+    else if (id <= m_sources.count())
+      reader = &m_sources.at(id - 1)->frameReader();
+    else
+      continue;
+
+    // Publish the frames of the source
+    auto batch = reader->takeFrames();
+    batch.source = id;
+    if (!batch.isEmpty() && !paused())
+      Q_EMIT framesReceived(batch);
+  }
+}
+
+/**
+ * @brief Applies the batching & backpressure settings of the manager to the
+ *        frame reader of an additional data source.
+ */
+void IO::Manager::configureFrameReader(FrameReader *reader)
+{
+  const auto latency = m_batchLatency;
+  reader->setQueueCapacity(m_queueCapacity);
+  reader->setBackpressurePolicy(m_backpressurePolicy);
+  QMetaObject::invokeMethod(
+      reader, [=] { reader->setBatchLatency(latency); },
+      Qt::QueuedConnection);
+}
+
 /**
  * @brief Sets the hardware abstraction layer (HAL) driver.
  *
@@ -574,8 +943,11 @@ void IO::Manager::setDriver(HAL_Driver *driver)
   if (m_driver != driver)
   {
     if (driver)
+    {
+      driver->setIoThread(&m_ioThread);
       connect(driver, &IO::HAL_Driver::configurationChanged, this,
               &IO::Manager::configurationChanged);
+    }
 
     if (m_driver)
       disconnect(m_driver);
@@ -602,7 +974,7 @@ void IO::Manager::setDriver(HAL_Driver *driver)
  */
 bool IO::Manager::eventFilter(QObject *obj, QEvent *event)
 {
-  if (isConnected() && event->type() == QEvent::KeyPress)
+  if (event->type() == QEvent::KeyPress && isConnected())
   {
     const auto *e = static_cast<QKeyEvent *>(event);
     if ((e->modifiers() & Qt::ControlModifier) && e->key() == Qt::Key_P)
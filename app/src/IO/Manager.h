@@ -23,9 +23,13 @@
 
 #include <QThread>
 #include <QObject>
+#include <QVector>
 #include <QKeyEvent>
 
+#include <atomic>
+
 #include "SerialStudio.h"
+#include "IO/Source.h"
 #include "IO/HAL_Driver.h"
 #include "IO/FrameReader.h"
 
@@ -39,7 +43,18 @@ namespace IO
  * managing configuration, connection, and data transfer.
  *
  * Integrates with `FrameReader` for parsing data streams and ensures
- * thread-safe operation using a dedicated worker thread.
+ * thread-safe operation using a dedicated worker thread. Drivers that support
+ * it perform their device I/O in a separate event-loop thread, so that reads
+ * are never delayed by QML rendering.
+ *
+ * Projects may define additional data sources (see `IO::Source`) that are
+ * opened and closed together with the main device. Each source splits its
+ * data into frames in its own thread. Frame readers flag the manager through
+ * an atomic bit mask when they have frames pending, so that the frames of all
+ * sources are collected with a single event in the GUI thread, without the
+ * readers ever waiting for each other. Consumers that cannot keep up may hold
+ * the frames in the readers (see `setFramesHeld()`), whose queues then apply
+ * the backpressure policy.
  */
 class Manager : public QObject
 {
@@ -70,6 +85,30 @@ class Manager : public QObject
              READ finishSequence
              WRITE setFinishSequence
              NOTIFY finishSequenceChanged)
+  Q_PROPERTY(int batchLatency
+             READ batchLatency
+             WRITE setBatchLatency
+             NOTIFY batchLatencyChanged)
+  Q_PROPERTY(int queueCapacity
+             READ queueCapacity
+             WRITE setQueueCapacity
+             NOTIFY queueCapacityChanged)
+  Q_PROPERTY(SerialStudio::BackpressurePolicy backpressurePolicy
+             READ backpressurePolicy
+             WRITE setBackpressurePolicy
+             NOTIFY backpressurePolicyChanged)
+  Q_PROPERTY(QStringList backpressurePolicies
+             READ backpressurePolicies
+             NOTIFY backpressurePolicyChanged)
+  Q_PROPERTY(quint64 droppedFrames
+             READ droppedFrames
+             NOTIFY dropCountersChanged)
+  Q_PROPERTY(quint64 droppedBytes
+             READ droppedBytes
+             NOTIFY dropCountersChanged)
+  Q_PROPERTY(quint64 ingressDroppedBytes
+             READ ingressDroppedBytes
+             NOTIFY dropCountersChanged)
   Q_PROPERTY(bool configurationOk
              READ configurationOk
              NOTIFY configurationChanged)
@@ -83,6 +122,10 @@ signals:
   void pausedChanged();
   void busTypeChanged();
   void busListChanged();
+  void batchLatencyChanged();
+  void queueCapacityChanged();
+  void dropCountersChanged();
+  void backpressurePolicyChanged();
   void connectedChanged();
   void writeEnabledChanged();
   void configurationChanged();
@@ -91,7 +134,7 @@ signals:
   void finishSequenceChanged();
   void dataSent(const QByteArray &data);
   void dataReceived(const QByteArray &data);
-  void frameReceived(const QByteArray &frame);
+  void framesReceived(const IO::FrameBatch &batch);
 
 private:
   explicit Manager();
@@ -109,6 +152,14 @@ public:
   [[nodiscard]] bool isConnected();
   [[nodiscard]] bool configurationOk();
 
+  [[nodiscard]] int batchLatency() const;
+  [[nodiscard]] int queueCapacity() const;
+  [[nodiscard]] quint64 droppedBytes() const;
+  [[nodiscard]] quint64 droppedFrames() const;
+  [[nodiscard]] quint64 ingressDroppedBytes() const;
+  [[nodiscard]] FrameReaderStatistics statistics() const;
+  [[nodiscard]] QStringList backpressurePolicies() const;
+  [[nodiscard]] SerialStudio::BackpressurePolicy backpressurePolicy() const;
   [[nodiscard]] HAL_Driver *driver();
   [[nodiscard]] SerialStudio::BusType busType() const;
 
@@ -124,27 +175,47 @@ public slots:
   void disconnectDevice();
   void setupExternalConnections();
   void setPaused(const bool paused);
+  void setFramesHeld(const bool held);
   void setWriteEnabled(const bool enabled);
+  void setBatchLatency(const int milliseconds);
+  void setQueueCapacity(const int frames);
+  void setBackpressurePolicy(const SerialStudio::BackpressurePolicy policy);
   void processPayload(const QByteArray &payload);
   void setStartSequence(const QString &sequence);
   void setFinishSequence(const QString &sequence);
   void setBusType(const SerialStudio::BusType &driver);
+  void setSources(const QVector<IO::SourceConfig> &sources);
 
 private slots:
+  void collectFrames();
   void setDriver(IO::HAL_Driver *driver);
 
+private:
+  void openSources(const QIODevice::OpenMode mode);
+  void closeSources();
+  void notifyFramesReady(const int source);
+  void configureFrameReader(FrameReader *reader);
+
 protected:
   bool eventFilter(QObject *obj, QEvent *event) override;
 
 private:
   bool m_paused;
+  int m_batchLatency;
+  int m_queueCapacity;
+  SerialStudio::BackpressurePolicy m_backpressurePolicy;
   bool m_writeEnabled;
   SerialStudio::BusType m_busType;
 
   HAL_Driver *m_driver;
+  QThread m_ioThread;
   QThread m_workerThread;
   FrameReader m_frameReader;
 
+  bool m_framesHeld;
+  QVector<Source *> m_sources;
+  std::atomic<quint64> m_pendingSources;
+
   QString m_startSequence;
   QString m_finishSequence;
 };
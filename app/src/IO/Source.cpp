@@ -0,0 +1,257 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "IO/Source.h"
+#include "IO/Drivers/UART.h"
+#include "IO/Drivers/Network.h"
+#include "Misc/ThreadScheduler.h"
+
+/**
+ * @brief Reads a value from a JSON object, or returns @a defaultValue if the
+ *        object does not contain the given @a key.
+ */
+static QVariant SAFE_READ(const QJsonObject &object, const QString &key,
+                          const QVariant &defaultValue)
+{
+  if (object.contains(key))
+    return object.value(key);
+
+  return defaultValue;
+}
+
+//------------------------------------------------------------------------------
+// Source configuration
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Initializes a network source that reads newline-terminated frames.
+ */
+IO::SourceConfig::SourceConfig()
+  : busType(SerialStudio::BusType::Network)
+  , baudRate(9600)
+  , socketType(QAbstractSocket::UdpSocket)
+  , tcpPort(Drivers::Network::defaultTcpPort())
+  , udpLocalPort(Drivers::Network::defaultUdpLocalPort())
+  , udpRemotePort(Drivers::Network::defaultUdpRemotePort())
+  , frameEnd(QStringLiteral("\\n"))
+  , frameDetection(SerialStudio::EndDelimiterOnly)
+  , checksum(SerialStudio::AutoDetectChecksum)
+  , decoder(SerialStudio::PlainText)
+{
+}
+
+/**
+ * @brief Reads the source settings from the given JSON @a object.
+ *
+ * Keys that are not present keep their default values, so that a source only
+ * needs to specify what differs from a newline-terminated UDP stream.
+ *
+ * @return @c true if the object describes a serial or network source.
+ */
+bool IO::SourceConfig::read(const QJsonObject &object)
+{
+  if (object.isEmpty())
+    return false;
+
+  // Read enumerated values
+  const auto bus = SAFE_READ(object, "busType", static_cast<int>(busType));
+  const auto detection = SAFE_READ(object, "frameDetection", frameDetection);
+  const auto algorithm = SAFE_READ(object, "checksum", checksum);
+  const auto method = SAFE_READ(object, "decoder", decoder);
+
+  // Read device settings
+  title = SAFE_READ(object, "title", "").toString().simplified();
+  busType = static_cast<SerialStudio::BusType>(bus.toInt());
+  portName = SAFE_READ(object, "portName", "").toString().simplified();
+  baudRate = SAFE_READ(object, "baudRate", baudRate).toInt();
+  remoteAddress = SAFE_READ(object, "remoteAddress", "").toString().trimmed();
+  socketType = SAFE_READ(object, "socketType", socketType).toInt();
+  tcpPort = SAFE_READ(object, "tcpPort", tcpPort).toUInt();
+  udpLocalPort = SAFE_READ(object, "udpLocalPort", udpLocalPort).toUInt();
+  udpRemotePort = SAFE_READ(object, "udpRemotePort", udpRemotePort).toUInt();
+
+  // Read frame detection settings
+  frameEnd = SAFE_READ(object, "frameEnd", frameEnd).toString();
+  frameStart = SAFE_READ(object, "frameStart", frameStart).toString();
+  frameDetection = static_cast<SerialStudio::FrameDetection>(detection.toInt());
+  checksum = static_cast<SerialStudio::ChecksumAlgorithm>(algorithm.toInt());
+  decoder = static_cast<SerialStudio::DecoderMethod>(method.toInt());
+
+  return busType == SerialStudio::BusType::UART
+         || busType == SerialStudio::BusType::Network;
+}
+
+//------------------------------------------------------------------------------
+// Source object
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Creates the driver of the source and starts its frame reader thread.
+ *
+ * @param id     Index of the source, 1 for the first additional source.
+ * @param config Device & frame detection settings of the source.
+ * @param parent Parent object.
+ */
+IO::Source::Source(const int id, const SourceConfig &config, QObject *parent)
+  : QObject(parent)
+  , m_id(id)
+  , m_config(config)
+{
+  // Create and configure a serial port driver
+  if (config.busType == SerialStudio::BusType::UART)
+  {
+    auto *uart = new Drivers::UART();
+    uart->setBaudRate(config.baudRate);
+    uart->setPortName(config.portName);
+    m_driver.reset(uart);
+  }
+
+  // Create and configure a network socket driver
+  else if (config.busType == SerialStudio::BusType::Network)
+  {
+    auto *network = new Drivers::Network();
+    network->setTcpPort(config.tcpPort);
+    network->setUdpLocalPort(config.udpLocalPort);
+    network->setUdpRemotePort(config.udpRemotePort);
+    network->setRemoteAddress(config.remoteAddress);
+    if (config.socketType == QAbstractSocket::UdpSocket)
+      network->setSocketType(QAbstractSocket::UdpSocket);
+    else
+      network->setSocketType(QAbstractSocket::TcpSocket);
+
+    m_driver.reset(network);
+  }
+
+  // Configure frame detection, the frame reader does not follow the project
+  m_frameReader.setOperationMode(SerialStudio::ProjectFile);
+  m_frameReader.setStartSequence(config.frameStart);
+  m_frameReader.setFinishSequence(config.frameEnd);
+  m_frameReader.setFrameDetectionMode(config.frameDetection);
+  m_frameReader.setChecksumAlgorithm(config.checksum);
+
+  // Feed received data to the frame reader
+  if (m_driver)
+  {
+    connect(m_driver.get(), &IO::HAL_Driver::dataReceived, &m_frameReader,
+            &FrameReader::processData, Qt::QueuedConnection);
+    connect(m_driver.get(), &IO::HAL_Driver::datagramsReceived,
+            &m_frameReader, &FrameReader::processDatagrams,
+            Qt::QueuedConnection);
+  }
+
+  // Run the frame reader in its own thread
+  m_frameReader.moveToThread(&m_thread);
+  m_thread.setObjectName(QStringLiteral("Frame Reader %1").arg(id));
+  Misc::ThreadScheduler::instance().registerThread(
+      &m_thread, Misc::ThreadScheduler::Framing);
+  m_thread.start(QThread::HighestPriority);
+}
+
+/**
+ * @brief Closes the device and stops the frame reader thread.
+ */
+IO::Source::~Source()
+{
+  close();
+
+  m_thread.quit();
+  if (!m_thread.wait(100))
+    m_thread.terminate();
+}
+
+/**
+ * @brief Returns the index of the source, which is also the dataset index
+ *        namespace of the groups that read from it.
+ */
+int IO::Source::id() const
+{
+  return m_id;
+}
+
+/**
+ * @brief Returns @c true if the device of the source is open.
+ */
+bool IO::Source::isOpen() const
+{
+  if (m_driver)
+    return m_driver->isOpen();
+
+  return false;
+}
+
+/**
+ * @brief Returns the driver of the source, or @c nullptr if the bus type of
+ *        the source is not supported.
+ */
+IO::HAL_Driver *IO::Source::driver() const
+{
+  return m_driver.get();
+}
+
+/**
+ * @brief Returns the frame reader that splits the data of the source into
+ *        frames.
+ */
+IO::FrameReader &IO::Source::frameReader()
+{
+  return m_frameReader;
+}
+
+/**
+ * @brief Returns the settings that the source was created with.
+ */
+const IO::SourceConfig &IO::Source::config() const
+{
+  return m_config;
+}
+
+/**
+ * @brief Opens the device of the source.
+ *
+ * @param ioThread Thread in which the driver performs device I/O.
+ * @param mode     Open mode of the device.
+ *
+ * @return @c true if the device was opened.
+ */
+bool IO::Source::open(QThread *ioThread, const QIODevice::OpenMode mode)
+{
+  if (!m_driver)
+    return false;
+
+  QMetaObject::invokeMethod(&m_frameReader, &FrameReader::reset,
+                            Qt::BlockingQueuedConnection);
+
+  m_driver->setIoThread(ioThread);
+  return m_driver->open(mode);
+}
+
+/**
+ * @brief Closes the device of the source and discards pending frames.
+ */
+void IO::Source::close()
+{
+  if (m_driver)
+    m_driver->close();
+
+  if (m_thread.isRunning())
+    QMetaObject::invokeMethod(&m_frameReader, &FrameReader::reset,
+                              Qt::BlockingQueuedConnection);
+}
@@ -0,0 +1,103 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <QThread>
+#include <QObject>
+#include <QJsonObject>
+
+#include <memory>
+
+#include "SerialStudio.h"
+#include "IO/HAL_Driver.h"
+#include "IO/FrameReader.h"
+
+namespace IO
+{
+/**
+ * @brief Settings of an additional data source defined in a project file.
+ *
+ * Additional sources are listed in the @c sources array of the project. The
+ * main device configured in the setup pane is source 0, and the entries of
+ * the array are sources 1, 2, 3... in order. Groups select the source that
+ * feeds their datasets with their @c source key.
+ */
+struct SourceConfig
+{
+  QString title;                  /**< Name of the source. */
+  SerialStudio::BusType busType;  /**< Driver used by the source. */
+
+  QString portName;               /**< Serial port name or path. */
+  qint32 baudRate;                /**< Serial port baud rate. */
+
+  QString remoteAddress;          /**< Host of the network socket. */
+  int socketType;                 /**< 0 for TCP, 1 for UDP sockets. */
+  quint16 tcpPort;                /**< Remote port of TCP sockets. */
+  quint16 udpLocalPort;           /**< Local port of UDP sockets. */
+  quint16 udpRemotePort;          /**< Remote port of UDP sockets. */
+
+  QString frameStart;             /**< Start delimiter of frames. */
+  QString frameEnd;               /**< End delimiter of frames. */
+  SerialStudio::FrameDetection frameDetection;
+  SerialStudio::ChecksumAlgorithm checksum;
+  SerialStudio::DecoderMethod decoder;
+
+  SourceConfig();
+  [[nodiscard]] bool read(const QJsonObject &object);
+};
+
+/**
+ * @class IO::Source
+ * @brief An additional device that streams data in parallel to the main one.
+ *
+ * Each source owns its driver instance and a `FrameReader` running in its own
+ * thread, with the frame detection settings of the source. This way, several
+ * fast links are split into frames by several cores, and the frames of each
+ * link only meet again when the `IO::Manager` collects them.
+ */
+class Source : public QObject
+{
+  Q_OBJECT
+
+public:
+  explicit Source(const int id, const SourceConfig &config,
+                  QObject *parent = nullptr);
+  ~Source();
+
+  [[nodiscard]] int id() const;
+  [[nodiscard]] bool isOpen() const;
+  [[nodiscard]] HAL_Driver *driver() const;
+  [[nodiscard]] FrameReader &frameReader();
+  [[nodiscard]] const SourceConfig &config() const;
+
+  bool open(QThread *ioThread, const QIODevice::OpenMode mode);
+  void close();
+
+private:
+  int m_id;
+  SourceConfig m_config;
+
+  QThread m_thread;
+  FrameReader m_frameReader;
+  std::unique_ptr<HAL_Driver> m_driver;
+};
+} // namespace IO
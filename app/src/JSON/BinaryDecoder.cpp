@@ -0,0 +1,285 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+
+#include "JSON/BinaryDecoder.h"
+
+#include <QtEndian>
+
+#include <limits>
+
+namespace
+{
+/**
+ * @brief Reads a value of type @a T stored at @a data with the given byte
+ *        order, and applies the scale & offset of the @a field.
+ */
+template<typename T, bool BigEndian>
+double extractValue(const uchar *data, const JSON::BinaryField &field)
+{
+  T value;
+  if constexpr (BigEndian)
+    value = qFromBigEndian<T>(data);
+  else
+    value = qFromLittleEndian<T>(data);
+
+  return static_cast<double>(value) * field.scale + field.offset;
+}
+
+/**
+ * @brief Reads the bits of a bitfield from the unsigned integer of type @a T
+ *        stored at @a data, and applies the scale & offset of the @a field.
+ */
+template<typename T, bool BigEndian>
+double extractBits(const uchar *data, const JSON::BinaryField &field)
+{
+  T container;
+  if constexpr (BigEndian)
+    container = qFromBigEndian<T>(data);
+  else
+    container = qFromLittleEndian<T>(data);
+
+  const auto bits = static_cast<quint64>(container) >> field.bitOffset;
+  const auto mask = field.bitWidth >= 64 ? ~quint64(0)
+                                         : (quint64(1) << field.bitWidth) - 1;
+  return static_cast<double>(bits & mask) * field.scale + field.offset;
+}
+
+/**
+ * @brief Returns the extractor of type @a T for the byte order of the
+ *        given @a field.
+ */
+template<typename T>
+auto valueExtractor(const JSON::BinaryField &field)
+{
+  return field.bigEndian ? &extractValue<T, true> : &extractValue<T, false>;
+}
+
+/**
+ * @brief Returns the bitfield extractor of type @a T for the byte order of
+ *        the given @a field.
+ */
+template<typename T>
+auto bitsExtractor(const JSON::BinaryField &field)
+{
+  return field.bigEndian ? &extractBits<T, true> : &extractBits<T, false>;
+}
+} // namespace
+
+/**
+ * @brief Returns the number of bytes read from the frame for this field.
+ *
+ * Bitfields use the smallest unsigned integer (1, 2, 4 or 8 bytes) that
+ * contains all of their bits.
+ */
+int JSON::BinaryField::size() const
+{
+  switch (type)
+  {
+    case UInt8:
+    case Int8:
+      return 1;
+    case UInt16:
+    case Int16:
+      return 2;
+    case UInt32:
+    case Int32:
+    case Float32:
+      return 4;
+    case UInt64:
+    case Int64:
+    case Float64:
+      return 8;
+    case Bitfield:
+    {
+      const auto bits = bitOffset + bitWidth;
+      if (bits <= 8)
+        return 1;
+      if (bits <= 16)
+        return 2;
+      if (bits <= 32)
+        return 4;
+
+      return 8;
+    }
+  }
+
+  return 1;
+}
+
+/**
+ * @brief Returns @c true if the field has the default settings, which are
+ *        not written to project files.
+ */
+bool JSON::BinaryField::isDefault() const
+{
+  return *this == BinaryField();
+}
+
+/**
+ * @brief Serializes the field into a JSON object.
+ */
+QJsonObject JSON::BinaryField::serialize() const
+{
+  QJsonObject object;
+  object.insert(QStringLiteral("type"), type);
+  object.insert(QStringLiteral("byteOffset"), byteOffset);
+  object.insert(QStringLiteral("bigEndian"), bigEndian);
+  object.insert(QStringLiteral("bitOffset"), bitOffset);
+  object.insert(QStringLiteral("bitWidth"), bitWidth);
+  object.insert(QStringLiteral("scale"), scale);
+  object.insert(QStringLiteral("offset"), offset);
+  return object;
+}
+
+/**
+ * @brief Reads a field from the given JSON @a object, missing or invalid
+ *        settings are replaced with their default values.
+ */
+JSON::BinaryField JSON::BinaryField::read(const QJsonObject &object)
+{
+  BinaryField field;
+  const auto type = object.value(QStringLiteral("type")).toInt(UInt8);
+  field.type = static_cast<Type>(qBound<int>(UInt8, type, Bitfield));
+  field.byteOffset
+      = qMax(0, object.value(QStringLiteral("byteOffset")).toInt(0));
+  field.bigEndian = object.value(QStringLiteral("bigEndian")).toBool(true);
+  field.bitOffset
+      = qBound(0, object.value(QStringLiteral("bitOffset")).toInt(0), 63);
+  field.bitWidth = qBound(1, object.value(QStringLiteral("bitWidth")).toInt(1),
+                          64 - field.bitOffset);
+  field.scale = object.value(QStringLiteral("scale")).toDouble(1);
+  field.offset = object.value(QStringLiteral("offset")).toDouble(0);
+  return field;
+}
+
+/**
+ * @brief Removes all the fields of the decoder.
+ */
+void JSON::BinaryDecoder::clear()
+{
+  m_fields.clear();
+  m_extractors.clear();
+}
+
+/**
+ * @brief Appends the given @a field, whose value is stored at the same
+ *        position of the output of `decode()`.
+ */
+void JSON::BinaryDecoder::addField(const BinaryField &field)
+{
+  Extractor extractor = nullptr;
+  switch (field.type)
+  {
+    case BinaryField::UInt8:
+      extractor = valueExtractor<quint8>(field);
+      break;
+    case BinaryField::UInt16:
+      extractor = valueExtractor<quint16>(field);
+      break;
+    case BinaryField::UInt32:
+      extractor = valueExtractor<quint32>(field);
+      break;
+    case BinaryField::UInt64:
+      extractor = valueExtractor<quint64>(field);
+      break;
+    case BinaryField::Int8:
+      extractor = valueExtractor<qint8>(field);
+      break;
+    case BinaryField::Int16:
+      extractor = valueExtractor<qint16>(field);
+      break;
+    case BinaryField::Int32:
+      extractor = valueExtractor<qint32>(field);
+      break;
+    case BinaryField::Int64:
+      extractor = valueExtractor<qint64>(field);
+      break;
+    case BinaryField::Float32:
+      extractor = valueExtractor<float>(field);
+      break;
+    case BinaryField::Float64:
+      extractor = valueExtractor<double>(field);
+      break;
+    case BinaryField::Bitfield:
+      switch (field.size())
+      {
+        case 1:
+          extractor = bitsExtractor<quint8>(field);
+          break;
+        case 2:
+          extractor = bitsExtractor<quint16>(field);
+          break;
+        case 4:
+          extractor = bitsExtractor<quint32>(field);
+          break;
+        default:
+          extractor = bitsExtractor<quint64>(field);
+          break;
+      }
+      break;
+  }
+
+  m_fields.append(field);
+  m_extractors.append(extractor);
+}
+
+/**
+ * @brief Returns the number of fields of the decoder.
+ */
+qsizetype JSON::BinaryDecoder::fieldCount() const
+{
+  return m_fields.size();
+}
+
+/**
+ * @brief Returns the fields of the decoder, in the order of the values
+ *        returned by `decode()`.
+ */
+const QVector<JSON::BinaryField> &JSON::BinaryDecoder::fields() const
+{
+  return m_fields;
+}
+
+/**
+ * @brief Decodes the value of each field of the given @a frame into
+ *        @a values.
+ *
+ * Fields that do not fit in the frame are set to NaN, so that a short frame
+ * does not overwrite the latest values of the datasets that it lacks.
+ */
+void JSON::BinaryDecoder::decode(const QByteArray &frame,
+                                 QVector<double> &values) const
+{
+  const auto count = m_fields.size();
+  const auto size = frame.size();
+  const auto *data = reinterpret_cast<const uchar *>(frame.constData());
+
+  values.resize(count);
+  for (qsizetype i = 0; i < count; ++i)
+  {
+    const auto &field = m_fields.at(i);
+    if (field.byteOffset + field.size() <= size)
+      values[i] = m_extractors.at(i)(data + field.byteOffset, field);
+    else
+      values[i] = std::numeric_limits<double>::quiet_NaN();
+  }
+}
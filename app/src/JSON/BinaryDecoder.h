@@ -0,0 +1,111 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+
+#pragma once
+
+#include <QVector>
+#include <QByteArray>
+#include <QJsonObject>
+
+namespace JSON
+{
+/**
+ * @brief Describes where & how the value of a dataset is stored in a binary
+ *        frame.
+ *
+ * The decoded value is `raw * scale + offset`, where `raw` is the number
+ * stored at @c byteOffset with the given type & byte order. Bitfields read
+ * @c bitWidth bits starting at bit @c bitOffset (counted from the least
+ * significant bit) of the smallest unsigned integer that contains them.
+ */
+struct BinaryField
+{
+  enum Type
+  {
+    UInt8,
+    UInt16,
+    UInt32,
+    UInt64,
+    Int8,
+    Int16,
+    Int32,
+    Int64,
+    Float32,
+    Float64,
+    Bitfield,
+  };
+
+  Type type = UInt8;     /**< Type of the stored value. */
+  int byteOffset = 0;    /**< Position of the first byte in the frame. */
+  bool bigEndian = true; /**< Byte order of multi-byte values. */
+  int bitOffset = 0;     /**< First bit of a bitfield. */
+  int bitWidth = 1;      /**< Number of bits of a bitfield. */
+  double scale = 1;      /**< Factor applied to the stored value. */
+  double offset = 0;     /**< Value added after scaling. */
+
+  [[nodiscard]] int size() const;
+  [[nodiscard]] bool isDefault() const;
+  [[nodiscard]] QJsonObject serialize() const;
+  [[nodiscard]] static BinaryField read(const QJsonObject &object);
+
+  bool operator==(const BinaryField &other) const
+  {
+    return type == other.type && byteOffset == other.byteOffset
+           && bigEndian == other.bigEndian && bitOffset == other.bitOffset
+           && bitWidth == other.bitWidth && scale == other.scale
+           && offset == other.offset;
+  }
+
+  bool operator!=(const BinaryField &other) const
+  {
+    return !(*this == other);
+  }
+};
+
+/**
+ * @class JSON::BinaryDecoder
+ * @brief Decodes the datasets of binary frames with a fixed layout.
+ *
+ * Each field is read directly from the frame bytes into a double, without
+ * creating any intermediate string. The extractor of each field is a
+ * template specialized for its type & byte order, which is selected once when
+ * the field is added, so that decoding a frame only calls one function per
+ * field.
+ */
+class BinaryDecoder
+{
+public:
+  void clear();
+  void addField(const BinaryField &field);
+
+  [[nodiscard]] qsizetype fieldCount() const;
+  [[nodiscard]] const QVector<BinaryField> &fields() const;
+
+  void decode(const QByteArray &frame, QVector<double> &values) const;
+
+private:
+  using Extractor = double (*)(const uchar *data, const BinaryField &field);
+
+  QVector<BinaryField> m_fields;
+  QVector<Extractor> m_extractors;
+};
+} // namespace JSON
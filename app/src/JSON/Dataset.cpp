@@ -237,6 +237,15 @@ const QJsonObject &JSON::Dataset::jsonData() const
   return m_jsonData;
 }
 
+/**
+ * Returns the position, type & byte order of the dataset value in binary
+ * frames, used by projects that decode frames as binary structures.
+ */
+const JSON::BinaryField &JSON::Dataset::binaryField() const
+{
+  return m_binaryField;
+}
+
 /**
  * @brief Encodes the dataset information into a QJsonObject.
  *
@@ -266,6 +275,9 @@ QJsonObject JSON::Dataset::serialize() const
   object.insert(QStringLiteral("widget"), m_widget.simplified());
   object.insert(QStringLiteral("fftSamplingRate"), m_fftSamplingRate);
   object.insert(QStringLiteral("overviewDisplay"), m_displayInOverview);
+  if (!m_binaryField.isDefault())
+    object.insert(QStringLiteral("binary"), m_binaryField.serialize());
+
   return object;
 }
 
@@ -295,6 +307,8 @@ bool JSON::Dataset::read(const QJsonObject &object)
     m_widget = SAFE_READ(object, "widget", "").toString().simplified();
     m_fftSamplingRate = SAFE_READ(object, "fftSamplingRate", 100).toInt();
     m_displayInOverview = SAFE_READ(object, "overviewDisplay", false).toBool();
+    m_binaryField = JSON::BinaryField::read(
+        object.value(QStringLiteral("binary")).toObject());
     if (m_value.isEmpty())
       m_value = QStringLiteral("--.--");
 
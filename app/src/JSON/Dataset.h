@@ -25,6 +25,8 @@
 #include <QVariant>
 #include <QJsonObject>
 
+#include "JSON/BinaryDecoder.h"
+
 namespace JSON
 {
 class ProjectModel;
@@ -96,6 +98,7 @@ public:
   [[nodiscard]] const QString &units() const;
   [[nodiscard]] const QString &widget() const;
   [[nodiscard]] const QJsonObject &jsonData() const;
+  [[nodiscard]] const JSON::BinaryField &binaryField() const;
 
   [[nodiscard]] QJsonObject serialize() const;
   [[nodiscard]] bool read(const QJsonObject &object);
@@ -116,6 +119,7 @@ private:
   QString m_units;
   QString m_widget;
   QJsonObject m_jsonData;
+  JSON::BinaryField m_binaryField;
 
   int m_index;
   double m_max;
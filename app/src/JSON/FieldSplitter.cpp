@@ -0,0 +1,224 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+
+#include "JSON/FieldSplitter.h"
+
+#include <charconv>
+
+namespace
+{
+/**
+ * @brief Converts the @a length bytes at @a begin to a number.
+ *
+ * @return @c true if the whole field is a number, which is stored in
+ *         @a value.
+ */
+bool toNumber(const char *begin, qsizetype length, double &value)
+{
+  // std::from_chars() does not accept a leading plus sign
+  if (length > 1 && *begin == '+' && begin[1] != '-')
+  {
+    ++begin;
+    --length;
+  }
+
+  if (length <= 0)
+    return false;
+
+#if defined(__cpp_lib_to_chars)
+  const auto *end = begin + length;
+  const auto result = std::from_chars(begin, end, value);
+  return result.ec == std::errc() && result.ptr == end;
+#else
+  bool ok = false;
+  value = QByteArray::fromRawData(begin, length).toDouble(&ok);
+  return ok;
+#endif
+}
+} // namespace
+
+/**
+ * @brief Creates a format from the settings of a project, where the
+ *        @a separator may contain escape sequences (e.g. `\t`) and only the
+ *        first character of @a quote is used.
+ *
+ * An empty separator falls back to a comma, and an empty @a quote disables
+ * quoted fields.
+ */
+JSON::FieldSplitterFormat
+JSON::FieldSplitterFormat::fromProject(const QString &separator,
+                                       const QString &quote, const bool trim)
+{
+  // Resolve escape sequences
+  auto resolved = separator;
+  resolved.replace(QStringLiteral("\\t"), QStringLiteral("\t"));
+  resolved.replace(QStringLiteral("\\r"), QStringLiteral("\r"));
+  resolved.replace(QStringLiteral("\\n"), QStringLiteral("\n"));
+
+  // Create the format
+  FieldSplitterFormat format;
+  format.trim = trim;
+  if (!resolved.isEmpty())
+    format.separator = resolved.toUtf8();
+  if (!quote.isEmpty() && quote.at(0).unicode() < 0x80)
+    format.quote = quote.at(0).toLatin1();
+
+  return format;
+}
+
+/**
+ * @brief Creates a field splitter with the given @a format.
+ */
+JSON::FieldSplitter::FieldSplitter(const FieldSplitterFormat &format)
+  : m_format(format)
+{
+}
+
+/**
+ * @brief Returns the format used to split frames.
+ */
+const JSON::FieldSplitterFormat &JSON::FieldSplitter::format() const
+{
+  return m_format;
+}
+
+/**
+ * @brief Returns the text of the given @a field of the @a frame, with
+ *        escaped (doubled) quote characters replaced by a single quote.
+ */
+QString JSON::FieldSplitter::text(const QByteArray &frame,
+                                  const Field &field) const
+{
+  auto text = QString::fromUtf8(frame.constData() + field.offset,
+                                field.length);
+  if (field.quoted)
+  {
+    const QString quote(QLatin1Char(m_format.quote));
+    text.replace(quote + quote, quote);
+  }
+
+  return text;
+}
+
+/**
+ * @brief Changes the format used to split frames.
+ */
+void JSON::FieldSplitter::setFormat(const FieldSplitterFormat &format)
+{
+  m_format = format;
+}
+
+/**
+ * @brief Splits the given @a frame into @a fields.
+ *
+ * Like `String.split()` in JavaScript, a frame with N separators always has
+ * N + 1 fields, even if some of them are empty. If quoting is enabled, a
+ * field that starts with the quote character ends at the next quote that is
+ * not doubled, and may contain separators.
+ */
+void JSON::FieldSplitter::split(const QByteArray &frame,
+                                QVector<Field> &fields) const
+{
+  fields.clear();
+
+  // Obtain the format & the frame data
+  const auto *data = frame.constData();
+  const auto size = frame.size();
+  const auto quote = m_format.quote;
+  const auto &separator = m_format.separator;
+  const auto separatorLength = separator.size();
+
+  // Whitespace that is part of the separator is never trimmed
+  auto isTrimmed = [&](const char c) {
+    return m_format.trim
+           && (c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '\v'
+               || c == '\f')
+           && !separator.contains(c);
+  };
+
+  // Finds the next separator starting at the given position
+  auto findSeparator = [&](const qsizetype from) {
+    if (separatorLength == 1)
+      return frame.indexOf(separator.at(0), from);
+
+    return frame.indexOf(separator, from);
+  };
+
+  qsizetype position = 0;
+  while (true)
+  {
+    // Skip leading whitespace
+    Field field;
+    qsizetype begin = position;
+    while (begin < size && isTrimmed(data[begin]))
+      ++begin;
+
+    // Quoted field, find the closing quote
+    qsizetype next = -1;
+    if (quote != '\0' && begin < size && data[begin] == quote)
+    {
+      qsizetype end = begin + 1;
+      while (end < size)
+      {
+        if (data[end] == quote)
+        {
+          if (end + 1 < size && data[end + 1] == quote)
+          {
+            end += 2;
+            continue;
+          }
+
+          break;
+        }
+
+        ++end;
+      }
+
+      field.quoted = true;
+      field.offset = begin + 1;
+      field.length = end - field.offset;
+      next = findSeparator(qMin(end + 1, size));
+    }
+
+    // Unquoted field, ends at the next separator
+    else
+    {
+      next = findSeparator(begin);
+      qsizetype end = next < 0 ? size : next;
+      while (end > begin && isTrimmed(data[end - 1]))
+        --end;
+
+      field.offset = begin;
+      field.length = end - begin;
+    }
+
+    // Convert the field to a number
+    field.numeric = toNumber(data + field.offset, field.length, field.value);
+    fields.append(field);
+
+    // Stop after the last field
+    if (next < 0)
+      break;
+
+    position = next + separatorLength;
+  }
+}
@@ -0,0 +1,95 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+
+#pragma once
+
+#include <QString>
+#include <QVector>
+#include <QByteArray>
+
+namespace JSON
+{
+/**
+ * @brief Describes how the native field splitter separates the fields of a
+ *        frame.
+ */
+struct FieldSplitterFormat
+{
+  QByteArray separator = ","; /**< Bytes between two fields. */
+  char quote = '\0';          /**< Encloses fields, @c '\0' for none. */
+  bool trim = true;           /**< Removes whitespace around each field. */
+
+  static FieldSplitterFormat fromProject(const QString &separator,
+                                         const QString &quote,
+                                         const bool trim);
+
+  bool operator==(const FieldSplitterFormat &other) const
+  {
+    return separator == other.separator && quote == other.quote
+           && trim == other.trim;
+  }
+
+  bool operator!=(const FieldSplitterFormat &other) const
+  {
+    return !(*this == other);
+  }
+};
+
+/**
+ * @class JSON::FieldSplitter
+ * @brief Splits frames into fields without running a JavaScript function.
+ *
+ * Most projects only split each frame with a separator. This class does so
+ * directly over the received bytes and converts each field to a number with
+ * `std::from_chars`, so that these frames skip the UTF-8 conversion, the
+ * JavaScript engine and the conversion of its results to strings.
+ *
+ * Fields are stored as offsets into the frame. Only fields that are not
+ * numbers need to be converted to text with `text()`.
+ */
+class FieldSplitter
+{
+public:
+  /**
+   * @brief A field of a frame.
+   */
+  struct Field
+  {
+    qsizetype offset = 0; /**< Position of the first byte of the field. */
+    qsizetype length = 0; /**< Number of bytes of the field. */
+    bool quoted = false;  /**< Field was enclosed in quote characters. */
+    bool numeric = false; /**< The whole field is a number. */
+    double value = 0;     /**< Value of the field, if it is a number. */
+  };
+
+  explicit FieldSplitter(const FieldSplitterFormat &format = {});
+
+  [[nodiscard]] const FieldSplitterFormat &format() const;
+  [[nodiscard]] QString text(const QByteArray &frame, const Field &field) const;
+
+  void setFormat(const FieldSplitterFormat &format);
+  void split(const QByteArray &frame, QVector<Field> &fields) const;
+
+private:
+  FieldSplitterFormat m_format;
+};
+} // namespace JSON
@@ -89,4 +89,17 @@ private:
   friend class UI::Dashboard;
   friend class JSON::FrameBuilder;
 };
+
+/**
+ * @brief Frames built from a batch of raw frames (see `IO::FrameBatch`).
+ *
+ * Each frame keeps the ingress timestamp of the raw frame it was built from.
+ * Only the groups of the data source of the batch hold new values.
+ */
+struct FrameBatch
+{
+  QVector<JSON::Frame> frames; /**< Frames, oldest first. */
+  QVector<qint64> timestamps;  /**< Ingress time of each frame (ns). */
+  int source = 0;              /**< Data source of the raw frames. */
+};
 } // namespace JSON
@@ -19,11 +19,14 @@
  * SPDX-License-Identifier: GPL-3.0-or-later
  */
 
+#include <QLocale>
+#include <QtMath>
 #include <QFileInfo>
 #include <QFileDialog>
 
 #include "IO/Manager.h"
 #include "Misc/Utilities.h"
+#include "Misc/LatencyMonitor.h"
 
 #include "CSV/Player.h"
 #include "JSON/ProjectModel.h"
@@ -38,8 +41,17 @@
  */
 JSON::FrameBuilder::FrameBuilder()
   : m_opMode(SerialStudio::ProjectFile)
+  , m_decoder(SerialStudio::PlainText)
+  , m_parserMethod(SerialStudio::ScriptParser)
+  , m_parallelParsing(false)
   , m_frameParser(nullptr)
+  , m_parseErrors(0)
+  , m_droppedFrames(0)
 {
+  // Build frames once the parser pool delivers the parsed fields
+  connect(&m_parserPool, &JSON::ParserPool::framesParsed, this,
+          &JSON::FrameBuilder::onFramesParsed);
+
   // Read JSON map location
   auto path = m_settings.value("json_map_location", "").toString();
   if (!path.isEmpty())
@@ -96,6 +108,38 @@ QString JSON::FrameBuilder::jsonMapFilename() const
   return "";
 }
 
+/**
+ * Returns the number of frames for which the frame parser function threw an
+ * exception since the device was connected, including the frames received
+ * while the function of the project could not be loaded.
+ *
+ * @note This function is thread-safe.
+ */
+quint64 JSON::FrameBuilder::parseErrors() const
+{
+  return m_parseErrors.load(std::memory_order_relaxed);
+}
+
+/**
+ * Returns the number of frames discarded since the device was connected
+ * because they could not be handed to the frame parser workers.
+ *
+ * @note This function is thread-safe.
+ */
+quint64 JSON::FrameBuilder::droppedFrames() const
+{
+  return m_droppedFrames.load(std::memory_order_relaxed);
+}
+
+/**
+ * Returns the number of frames that were handed to the frame parser workers
+ * and whose parsed values were not used to build a frame yet.
+ */
+qsizetype JSON::FrameBuilder::pendingFrames() const
+{
+  return m_parserPool.pendingFrames();
+}
+
 /**
  * Returns a pointer to the currently loaded frame parser editor.
  */
@@ -132,8 +176,15 @@ void JSON::FrameBuilder::loadJsonMap()
  */
 void JSON::FrameBuilder::setupExternalConnections()
 {
-  connect(&IO::Manager::instance(), &IO::Manager::frameReceived, this,
+  connect(&IO::Manager::instance(), &IO::Manager::framesReceived, this,
           &JSON::FrameBuilder::readData, Qt::QueuedConnection);
+  connect(&m_parserPool, &JSON::ParserPool::capacityAvailable, this,
+          [=] { IO::Manager::instance().setFramesHeld(false); });
+  connect(&IO::Manager::instance(), &IO::Manager::connectedChanged, this,
+          [=] {
+            m_parseErrors.store(0, std::memory_order_relaxed);
+            m_droppedFrames.store(0, std::memory_order_relaxed);
+          });
 }
 
 /**
@@ -149,6 +200,9 @@ void JSON::FrameBuilder::loadJsonMap(const QString &path)
   if (m_jsonMap.isOpen())
   {
     m_frame.clear();
+    m_sources.clear();
+    m_parserPool.clear();
+    m_binaryDecoders.clear();
     m_jsonMap.close();
     Q_EMIT jsonFileMapChanged();
   }
@@ -183,6 +237,9 @@ void JSON::FrameBuilder::loadJsonMap(const QString &path)
       // Update I/O manager settings
       if (ok && m_frame.isValid())
       {
+        readSources(document.object().value("sources").toArray());
+        readFrameParser(document.object());
+        readBinaryFields();
         if (operationMode() == SerialStudio::ProjectFile)
         {
           IO::Manager::instance().setFinishSequence(m_frame.frameEnd());
@@ -214,6 +271,10 @@ void JSON::FrameBuilder::loadJsonMap(const QString &path)
     m_jsonMap.close();
   }
 
+  // Update the additional data sources
+  if (operationMode() == SerialStudio::ProjectFile)
+    IO::Manager::instance().setSources(m_sources);
+
   // Update UI
   Q_EMIT jsonFileMapChanged();
 }
@@ -221,10 +282,23 @@ void JSON::FrameBuilder::loadJsonMap(const QString &path)
 /**
  * @brief Assigns an instance to the frame parser to be used to split frame
  *        data/elements into individual parts.
+ *
+ * The parser pool compiles the script of the editor whenever it is changed,
+ * so that unsaved changes take effect right away.
  */
 void JSON::FrameBuilder::setFrameParser(JSON::FrameParser *parser)
 {
   m_frameParser = parser;
+  if (!parser)
+    return;
+
+  connect(parser, &JSON::FrameParser::scriptChanged, this, [=] {
+    if (m_frameParser == parser && !m_parserPool.load(parser->script()))
+      qWarning() << "Frame parser error:" << m_parserPool.errorString();
+  });
+
+  if (!parser->script().isEmpty())
+    (void)m_parserPool.load(parser->script());
 }
 
 /**
@@ -250,14 +324,17 @@ void JSON::FrameBuilder::setOperationMode(
     case SerialStudio::DeviceSendsJSON:
       IO::Manager::instance().setStartSequence("");
       IO::Manager::instance().setFinishSequence("");
+      IO::Manager::instance().setSources({});
       break;
     case SerialStudio::ProjectFile:
       IO::Manager::instance().setFinishSequence(m_frame.frameEnd());
       IO::Manager::instance().setStartSequence(m_frame.frameStart());
+      IO::Manager::instance().setSources(m_sources);
       break;
     case SerialStudio::QuickPlot:
       IO::Manager::instance().setStartSequence("");
       IO::Manager::instance().setFinishSequence("");
+      IO::Manager::instance().setSources({});
       break;
     default:
       qWarning() << "Invalid operation mode selected" << mode;
@@ -276,6 +353,232 @@ void JSON::FrameBuilder::setJsonPathSetting(const QString &path)
   m_settings.setValue(QStringLiteral("json_map_location"), path);
 }
 
+/**
+ * Reads the additional data sources of the project from the given @a array,
+ * and moves the dataset indexes of the groups that read from them to the
+ * index namespace of their source (see `JSON::Group::kSourceIndexStride`).
+ *
+ * Sources keep their position in the array as their number, even if they
+ * cannot be opened, so that the groups of the project stay consistent.
+ */
+void JSON::FrameBuilder::readSources(const QJsonArray &array)
+{
+  // Read source settings
+  m_sources.clear();
+  for (int i = 0; i < array.count(); ++i)
+  {
+    IO::SourceConfig config;
+    if (!config.read(array.at(i).toObject()))
+      qWarning() << "Unsupported data source" << i + 1;
+
+    m_sources.append(config);
+  }
+
+  // Offset dataset indexes of groups that read from additional sources
+  for (auto &group : m_frame.m_groups)
+  {
+    const auto offset = group.sourceId() * JSON::Group::kSourceIndexStride;
+    if (offset == 0)
+      continue;
+
+    for (auto &dataset : group.m_datasets)
+    {
+      dataset.m_index += offset;
+      if (dataset.m_xAxisId > 0)
+        dataset.m_xAxisId += offset;
+    }
+  }
+}
+
+/**
+ * Reads the parser method, the decoder method, the native separator settings,
+ * the parallel parsing flag & the frame parser function of the given project
+ * @a object, and loads the function into the workers of the parser pool.
+ *
+ * They are used to parse frames when the frame parser editor of the project
+ * editor has not been created, e.g. when running without user interface.
+ * Otherwise, the editor's script & the settings of the project model are
+ * used, so that unsaved changes take effect right away.
+ */
+void JSON::FrameBuilder::readFrameParser(const QJsonObject &object)
+{
+  const auto decoder = object.value(QStringLiteral("decoder")).toInt();
+  m_decoder = static_cast<SerialStudio::DecoderMethod>(decoder);
+
+  const auto method = object.value(QStringLiteral("parserMethod")).toInt();
+  m_parserMethod = static_cast<SerialStudio::ParserMethod>(method);
+  m_parallelParsing
+      = object.value(QStringLiteral("parallelParsing")).toBool(false);
+  m_fieldSplitter.setFormat(JSON::FieldSplitterFormat::fromProject(
+      object.value(QStringLiteral("fieldSeparator")).toString(),
+      object.value(QStringLiteral("quoteCharacter")).toString(),
+      object.value(QStringLiteral("trimFields")).toBool(true)));
+
+  auto code = object.value(QStringLiteral("frameParser")).toString();
+  if (m_frameParser && !m_frameParser->script().isEmpty())
+    code = m_frameParser->script();
+
+  if (!m_parserPool.load(code))
+    qWarning() << "Frame parser error:" << m_parserPool.errorString();
+}
+
+/**
+ * Creates a binary decoder for each data source with the binary fields of
+ * the datasets of the groups that read from it, in the same order in which
+ * `buildFrame()` visits them.
+ */
+void JSON::FrameBuilder::readBinaryFields()
+{
+  m_binaryDecoders.clear();
+  m_binaryDecoders.resize(m_sources.size() + 1);
+  for (const auto &group : std::as_const(m_frame.m_groups))
+  {
+    const auto source = group.sourceId();
+    if (source < 0 || source >= m_binaryDecoders.size())
+      continue;
+
+    for (const auto &dataset : group.m_datasets)
+      m_binaryDecoders[source].addField(dataset.binaryField());
+  }
+}
+
+/**
+ * Builds a frame from each raw frame of the given @a batch and notifies the
+ * rest of the application with a single batch of frames.
+ */
+void JSON::FrameBuilder::readData(const IO::FrameBatch &batch)
+{
+  // Use the separator settings of the project editor, if any
+  if (m_frameParser)
+  {
+    const auto format = JSON::ProjectModel::instance().fieldSplitterFormat();
+    if (m_fieldSplitter.format() != format)
+      m_fieldSplitter.setFormat(format);
+  }
+
+  // Let the parser pool run the frame parser function of the project
+  if (operationMode() == SerialStudio::ProjectFile
+      && parserMethod() == SerialStudio::ScriptParser
+      && !CSV::Player::instance().isOpen())
+  {
+    // No valid frame parser function, count the frames as parse errors
+    if (!m_parserPool.isLoaded())
+    {
+      quint64 errors = 0;
+      for (const auto &data : batch.frames)
+        errors += data.isEmpty() ? 0 : 1;
+
+      m_parseErrors.fetch_add(errors, std::memory_order_relaxed);
+      return;
+    }
+
+    // Binary frames are handed over to the pool without converting them
+    const auto decoder = decoderMethod(batch.source);
+    const bool binary = (decoder == SerialStudio::Binary);
+
+    QStringList frames;
+    QByteArrayList binaryFrames;
+    QVector<qint64> timestamps;
+    timestamps.reserve(batch.size());
+    if (binary)
+      binaryFrames.reserve(batch.size());
+    else
+      frames.reserve(batch.size());
+
+    for (qsizetype i = 0; i < batch.size(); ++i)
+    {
+      const auto &data = batch.frames.at(i);
+      if (!data.isEmpty())
+      {
+        if (binary)
+          binaryFrames.append(data);
+        else
+          frames.append(decodeFrame(data, decoder));
+
+        timestamps.append(batch.timestamps.at(i));
+      }
+    }
+
+    m_parserPool.setParallelParsing(parallelParsing());
+    const bool submitted
+        = binary ? m_parserPool.submit(binaryFrames, timestamps, batch.source)
+                 : m_parserPool.submit(frames, timestamps, batch.source);
+    if (!submitted)
+      m_droppedFrames.fetch_add(timestamps.size(), std::memory_order_relaxed);
+
+    // Leave the next frames in the frame readers until the workers catch up
+    if (m_parserPool.isSaturated())
+      IO::Manager::instance().setFramesHeld(true);
+
+    return;
+  }
+
+  // Build the frames
+  m_batch.frames.clear();
+  m_batch.timestamps.clear();
+  m_batch.source = batch.source;
+  for (qsizetype i = 0; i < batch.size(); ++i)
+    buildFrame(batch.frames.at(i), batch.timestamps.at(i), batch.source);
+
+  // Measure the parsing latency & update user interface
+  if (!m_batch.frames.isEmpty())
+  {
+    Misc::LatencyMonitor::instance().record(Misc::LatencyMonitor::Parsing,
+                                            m_batch.timestamps);
+    Q_EMIT framesChanged(m_batch);
+  }
+}
+
+/**
+ * Builds a frame with the fields of each frame of the given @a job, which the
+ * parser pool delivers in the same order in which the frames were received,
+ * and notifies the rest of the application with a single batch of frames.
+ */
+void JSON::FrameBuilder::onFramesParsed(const JSON::ParseJob &job)
+{
+  // Frames may still arrive after changing the operation mode
+  if (operationMode() != SerialStudio::ProjectFile)
+    return;
+
+  // Count frames that the parser function failed to process
+  if (job.errors > 0)
+    m_parseErrors.fetch_add(job.errors, std::memory_order_relaxed);
+
+  // Build the frames
+  m_batch.frames.clear();
+  m_batch.timestamps.clear();
+  m_batch.source = job.source;
+  const bool batchParser = job.fields.isEmpty();
+  for (qsizetype i = 0; i < job.timestamps.size(); ++i)
+  {
+    // Values returned by parseBatch(), only format the ones that are used
+    const auto timestamp = job.timestamps.at(i);
+    if (batchParser)
+    {
+      const auto *values = job.values.constData() + i * job.stride;
+      updateFrame(job.stride, timestamp, job.source, [&](const qsizetype n) {
+        return QString::number(values[n], 'g', QLocale::FloatingPointShortest);
+      });
+    }
+
+    // Fields returned by parse()
+    else
+    {
+      const auto &fields = job.fields.at(i);
+      updateFrame(fields.count(), timestamp, job.source,
+                  [&](const qsizetype n) { return fields.at(n); });
+    }
+  }
+
+  // Measure the parsing latency & update user interface
+  if (!m_batch.frames.isEmpty())
+  {
+    Misc::LatencyMonitor::instance().record(Misc::LatencyMonitor::Parsing,
+                                            m_batch.timestamps);
+    Q_EMIT framesChanged(m_batch);
+  }
+}
+
 /**
  * Tries to parse the given data as a JSON document according to the selected
  * operation mode.
@@ -286,10 +589,15 @@ void JSON::FrameBuilder::setJsonPathSetting(const QString &path)
  *           to use a JSON map file (given by the user) to know what each value
  *           means
  *
- * If JSON parsing is successfull, then the class shall notify the rest of the
- * application in order to process packet data.
+ * If JSON parsing is successfull, the resulting frame is added to the batch
+ * that is later sent to the rest of the application, together with the
+ * ingress @a timestamp of the raw data.
+ *
+ * In project mode, only the groups that read from the given data @a source
+ * are updated, the rest of the groups keep their latest values.
  */
-void JSON::FrameBuilder::readData(const QByteArray &data)
+void JSON::FrameBuilder::buildFrame(const QByteArray &data,
+                                    const qint64 timestamp, const int source)
 {
   // Data empty, abort
   if (data.isEmpty())
@@ -300,60 +608,65 @@ void JSON::FrameBuilder::readData(const QByteArray &data)
   {
     auto jsonData = QJsonDocument::fromJson(data).object();
     if (m_frame.read(jsonData))
-      Q_EMIT frameChanged(m_frame);
+    {
+      m_batch.frames.append(m_frame);
+      m_batch.timestamps.append(timestamp);
+    }
   }
 
-  // Data is separated and parsed by Serial Studio project
-  else if (operationMode() == SerialStudio::ProjectFile && m_frameParser)
+  // CSV data, no need to perform conversions or use frame parser (real-time
+  // data is parsed by the parser pool, see readData())
+  else if (operationMode() == SerialStudio::ProjectFile
+           && CSV::Player::instance().isOpen())
   {
-    // Obtain state of the app
-    const bool csvPlaying = CSV::Player::instance().isOpen();
+    const auto fields = QString::fromUtf8(data.simplified()).split(',');
+    updateFrame(fields.count(), timestamp, source,
+                [&](const qsizetype n) { return fields.at(n); });
+  }
 
-    // Real-time data, parse data & perform conversion
-    QStringList fields;
-    if (!csvPlaying)
-    {
-      // Convert binary frame data to a string
-      QString frameData;
-      switch (JSON::ProjectModel::instance().decoderMethod())
-      {
-        case SerialStudio::PlainText:
-          frameData = QString::fromUtf8(data);
-          break;
-        case SerialStudio::Hexadecimal:
-          frameData = QString::fromUtf8(data.toHex());
-          break;
-        case SerialStudio::Base64:
-          frameData = QString::fromUtf8(data.toBase64());
-          break;
-        default:
-          frameData = QString::fromUtf8(data);
-          break;
-      }
+  // Split the frame natively, numbers are converted from the raw bytes and
+  // only the fields that are not numbers are converted to text
+  else if (operationMode() == SerialStudio::ProjectFile
+           && parserMethod() == SerialStudio::NativeSeparator)
+  {
+    m_fieldSplitter.split(data, m_fields);
+    updateFrame(m_fields.count(), timestamp, source, [&](const qsizetype n) {
+      const auto &field = m_fields.at(n);
+      if (field.numeric)
+        return QString::number(field.value, 'g',
+                               QLocale::FloatingPointShortest);
+
+      return m_fieldSplitter.text(data, field);
+    });
+  }
 
-      // Get fields from frame parser function
-      fields = m_frameParser->parse(frameData);
-    }
+  // Decode the binary field of each dataset straight from the frame bytes,
+  // datasets whose field does not fit in the frame keep their latest value
+  else if (operationMode() == SerialStudio::ProjectFile
+           && parserMethod() == SerialStudio::BinaryStruct)
+  {
+    if (source < 0 || source >= m_binaryDecoders.size())
+      return;
 
-    // CSV data, no need to perform conversions or use frame parser
-    else
-      fields = QString::fromUtf8(data.simplified()).split(',');
+    m_binaryDecoders.at(source).decode(data, m_binaryValues);
 
-    // Replace data in frame
-    for (int g = 0; g < m_frame.groupCount(); ++g)
+    qsizetype i = 0;
+    for (auto &group : m_frame.m_groups)
     {
-      auto &group = m_frame.m_groups[g];
-      for (int d = 0; d < group.datasetCount(); ++d)
+      if (group.sourceId() != source)
+        continue;
+
+      for (auto &dataset : group.m_datasets)
       {
-        auto &dataset = group.m_datasets[d];
-        const auto index = dataset.index();
-        if (index <= fields.count() && index > 0)
-          dataset.m_value = fields.at(index - 1);
+        const auto value = m_binaryValues.at(i++);
+        if (!qIsNaN(value))
+          dataset.m_value
+              = QString::number(value, 'g', QLocale::FloatingPointShortest);
       }
     }
 
-    // Update user interface
-    Q_EMIT frameChanged(m_frame);
+    m_batch.frames.append(m_frame);
+    m_batch.timestamps.append(timestamp);
   }
 
   // Data is separated by comma separated values
@@ -419,6 +732,105 @@ void JSON::FrameBuilder::readData(const QByteArray &data)
     // Register container group
     frame.m_groups.append(plots);
 
-    Q_EMIT frameChanged(frame);
+    m_batch.frames.append(frame);
+    m_batch.timestamps.append(timestamp);
+  }
+}
+
+/**
+ * Replaces the values of the datasets of the groups that read from the given
+ * data @a source with the fields of a frame, and adds the resulting frame to
+ * the batch together with the ingress @a timestamp of the raw data.
+ *
+ * The frame has @a count fields, and @a field returns the text of the field
+ * with the given (zero-based) index. It is only called for the fields that
+ * are assigned to a dataset.
+ */
+template<typename Function>
+void JSON::FrameBuilder::updateFrame(const qsizetype count,
+                                     const qint64 timestamp, const int source,
+                                     Function &&field)
+{
+  // Replace data in frame
+  const auto offset = source * JSON::Group::kSourceIndexStride;
+  for (int g = 0; g < m_frame.groupCount(); ++g)
+  {
+    auto &group = m_frame.m_groups[g];
+    if (group.sourceId() != source)
+      continue;
+
+    for (int d = 0; d < group.datasetCount(); ++d)
+    {
+      auto &dataset = group.m_datasets[d];
+      const auto index = dataset.index() - offset;
+      if (index <= count && index > 0)
+        dataset.m_value = field(index - 1);
+    }
+  }
+
+  // Add frame to the batch
+  m_batch.frames.append(m_frame);
+  m_batch.timestamps.append(timestamp);
+}
+
+/**
+ * Returns how the fields of project frames are obtained, taken from the
+ * project editor if it has been created.
+ */
+SerialStudio::ParserMethod JSON::FrameBuilder::parserMethod() const
+{
+  if (m_frameParser)
+    return JSON::ProjectModel::instance().parserMethod();
+
+  return m_parserMethod;
+}
+
+/**
+ * Returns @c true if the frames of a data source may be parsed by several
+ * workers of the parser pool, the setting is taken from the project editor if
+ * it has been created.
+ */
+bool JSON::FrameBuilder::parallelParsing() const
+{
+  if (m_frameParser)
+    return JSON::ProjectModel::instance().parallelParsing();
+
+  return m_parallelParsing;
+}
+
+/**
+ * Returns the decoder method of the given data @a source, the decoder of the
+ * main device is taken from the project editor if it has been created.
+ */
+SerialStudio::DecoderMethod
+JSON::FrameBuilder::decoderMethod(const int source) const
+{
+  if (source > 0 && source <= m_sources.count())
+    return m_sources.at(source - 1).decoder;
+
+  if (m_frameParser)
+    return JSON::ProjectModel::instance().decoderMethod();
+
+  return m_decoder;
+}
+
+/**
+ * Converts the given binary frame @a data to the string that is passed to the
+ * frame parser function, according to the given @a decoder method.
+ */
+QString JSON::FrameBuilder::decodeFrame(
+    const QByteArray &data, const SerialStudio::DecoderMethod decoder) const
+{
+  // Convert binary frame data to a string
+  switch (decoder)
+  {
+    case SerialStudio::PlainText:
+      return QString::fromUtf8(data);
+    case SerialStudio::Hexadecimal:
+      return QString::fromUtf8(data.toHex());
+    case SerialStudio::Base64:
+      return QString::fromUtf8(data.toBase64());
+    default:
+      return QString::fromUtf8(data);
   }
 }
@@ -29,10 +29,17 @@
 #include <QJsonObject>
 #include <QJsonDocument>
 
+#include <atomic>
+
 #include "SerialStudio.h"
 
+#include "IO/Source.h"
+#include "IO/FrameBatch.h"
 #include "JSON/Frame.h"
 #include "JSON/FrameParser.h"
+#include "JSON/ParserPool.h"
+#include "JSON/FieldSplitter.h"
+#include "JSON/BinaryDecoder.h"
 
 namespace JSON
 {
@@ -45,7 +52,16 @@ namespace JSON
  * group.
  *
  * This frame is later shared with the rest of the modules, and is updated
- * automatically with new incoming raw data.
+ * automatically with new incoming raw data. Raw frames are received and
+ * published in batches, so that the number of events posted between threads
+ * does not grow with the frame rate.
+ *
+ * In project mode, the frame parser function runs on the worker threads of a
+ * `JSON::ParserPool`, and the frames are built once the pool delivers the
+ * parsed fields in their original order. Projects that only split frames
+ * with a separator can use a `JSON::FieldSplitter` instead, which runs on
+ * the received bytes without any JavaScript, and projects with binary frames
+ * can decode each dataset at a fixed position with a `JSON::BinaryDecoder`.
  */
 class FrameBuilder : public QObject
 {
@@ -66,7 +82,7 @@ class FrameBuilder : public QObject
 signals:
   void jsonFileMapChanged();
   void operationModeChanged();
-  void frameChanged(const JSON::Frame &frame);
+  void framesChanged(const JSON::FrameBatch &batch);
 
 private:
   explicit FrameBuilder();
@@ -80,6 +96,9 @@ public:
 
   [[nodiscard]] QString jsonMapFilepath() const;
   [[nodiscard]] QString jsonMapFilename() const;
+  [[nodiscard]] quint64 parseErrors() const;
+  [[nodiscard]] quint64 droppedFrames() const;
+  [[nodiscard]] qsizetype pendingFrames() const;
   [[nodiscard]] JSON::FrameParser *frameParser() const;
   [[nodiscard]] SerialStudio::OperationMode operationMode() const;
 
@@ -94,13 +113,43 @@ public slots:
   void setJsonPathSetting(const QString &path);
 
 private slots:
-  void readData(const QByteArray &data);
+  void readData(const IO::FrameBatch &batch);
+  void onFramesParsed(const JSON::ParseJob &job);
+
+private:
+  void readSources(const QJsonArray &array);
+  void readFrameParser(const QJsonObject &object);
+  void readBinaryFields();
+  void buildFrame(const QByteArray &data, const qint64 timestamp,
+                  const int source);
+  template<typename Function>
+  void updateFrame(const qsizetype count, const qint64 timestamp,
+                   const int source, Function &&field);
+  [[nodiscard]] QString
+  decodeFrame(const QByteArray &data,
+              const SerialStudio::DecoderMethod decoder) const;
+  [[nodiscard]] SerialStudio::DecoderMethod
+  decoderMethod(const int source) const;
+  [[nodiscard]] SerialStudio::ParserMethod parserMethod() const;
+  [[nodiscard]] bool parallelParsing() const;
 
 private:
   QFile m_jsonMap;
   JSON::Frame m_frame;
+  JSON::FrameBatch m_batch;
   QSettings m_settings;
   SerialStudio::OperationMode m_opMode;
+  SerialStudio::DecoderMethod m_decoder;
+  SerialStudio::ParserMethod m_parserMethod;
+  bool m_parallelParsing;
   JSON::FrameParser *m_frameParser;
+  JSON::ParserPool m_parserPool;
+  JSON::FieldSplitter m_fieldSplitter;
+  QVector<JSON::FieldSplitter::Field> m_fields;
+  QVector<JSON::BinaryDecoder> m_binaryDecoders;
+  QVector<double> m_binaryValues;
+  QVector<IO::SourceConfig> m_sources;
+  std::atomic<quint64> m_parseErrors;
+  std::atomic<quint64> m_droppedFrames;
 };
 } // namespace JSON
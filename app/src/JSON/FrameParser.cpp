@@ -146,6 +146,17 @@ QString JSON::FrameParser::text() const
   return m_widget.toPlainText();
 }
 
+/**
+ * @brief Returns the last script that was validated by @c loadScript().
+ *
+ * Frames are not parsed by the editor, but by the workers of the parser pool
+ * of the frame builder, which compile this script whenever it changes.
+ */
+QString JSON::FrameParser::script() const
+{
+  return m_script;
+}
+
 /**
  * @brief Indicates whenever there are any unsaved changes in the code editor.
  * @return
@@ -158,31 +169,6 @@ bool JSON::FrameParser::isModified() const
   return false;
 }
 
-/**
- * @brief Executes the current frame parser function over the input data.
- *
- * @param frame current/latest frame data.
- *
- * @return An array of strings with the values returned by the JS frame parser.
- */
-QStringList JSON::FrameParser::parse(const QString &frame)
-{
-  // Construct function arguments
-  QJSValueList args;
-  args << frame;
-
-  // Evaluate frame parsing function
-  auto out = m_parseFunction.call(args).toVariant().toStringList();
-
-  // Convert output to QStringList
-  QStringList list;
-  for (auto i = 0; i < out.count(); ++i)
-    list.append(out.at(i));
-
-  // Return fields list
-  return list;
-}
-
 /**
  * @brief Returns @c true whenever if there are any actions that can be undone.
  */
@@ -313,8 +299,13 @@ bool JSON::FrameParser::loadScript(const QString &script)
     return false;
   }
 
-  // We have reached this point without any errors, set function caller
-  m_parseFunction = fun;
+  // We have reached this point without any errors, update the parser pool
+  if (m_script != script)
+  {
+    m_script = script;
+    Q_EMIT scriptChanged();
+  }
+
   return true;
 }
 
@@ -41,6 +41,7 @@ class FrameParser : public QQuickPaintedItem
 
 signals:
   void textChanged();
+  void scriptChanged();
   void modifiedChanged();
 
 public:
@@ -49,8 +50,8 @@ public:
   static const QString &defaultCode();
 
   [[nodiscard]] QString text() const;
+  [[nodiscard]] QString script() const;
   [[nodiscard]] bool isModified() const;
-  [[nodiscard]] QStringList parse(const QString &frame);
 
   [[nodiscard]] bool undoAvailable() const;
   [[nodiscard]] bool redoAvailable() const;
@@ -99,6 +100,6 @@ private:
   QJSEngine m_engine;
   QSyntaxStyle m_style;
   QCodeEditor m_widget;
-  QJSValue m_parseFunction;
+  QString m_script;
 };
 } // namespace JSON
@@ -0,0 +1,345 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "JSON/FrameScript.h"
+
+#include <cstring>
+
+#include <QObject>
+
+namespace
+{
+/**
+ * @brief Appends the @a count elements of type @c T stored in @a data to the
+ *        given @a values.
+ */
+template<typename T>
+void appendElements(const char *data, const qsizetype count,
+                    QVector<double> &values)
+{
+  values.reserve(values.size() + count);
+  for (qsizetype i = 0; i < count; ++i)
+  {
+    T element;
+    std::memcpy(&element, data + i * sizeof(T), sizeof(T));
+    values.append(static_cast<double>(element));
+  }
+}
+
+/**
+ * @brief Appends the numbers of the given JavaScript array or typed array
+ *        @a array to @a values.
+ *
+ * Typed arrays are read directly from their underlying buffer, without
+ * converting each element to a @c QJSValue.
+ *
+ * @return @c false if @a array is neither an array nor a typed array.
+ */
+bool readNumbers(const QJSValue &array, QVector<double> &values)
+{
+  // Plain array, convert each element
+  const auto length = array.property(QStringLiteral("length")).toInt();
+  if (array.isArray())
+  {
+    values.reserve(length);
+    for (int i = 0; i < length; ++i)
+      values.append(array.property(i).toNumber());
+
+    return true;
+  }
+
+  // Obtain the buffer & the element type of a typed array
+  const auto buffer = array.property(QStringLiteral("buffer"));
+  if (!array.isObject() || !buffer.isObject())
+    return false;
+
+  const auto type = array.property(QStringLiteral("constructor"))
+                        .property(QStringLiteral("name"))
+                        .toString();
+  const auto size = array.property(QStringLiteral("BYTES_PER_ELEMENT")).toInt();
+  const auto offset = array.property(QStringLiteral("byteOffset")).toInt();
+  const auto bytes = buffer.toVariant().toByteArray();
+  if (size <= 0 || offset < 0 || offset + length * size > bytes.size())
+    return false;
+
+  // Convert the elements
+  const auto *data = bytes.constData() + offset;
+  if (type == QStringLiteral("Float64Array"))
+    appendElements<double>(data, length, values);
+  else if (type == QStringLiteral("Float32Array"))
+    appendElements<float>(data, length, values);
+  else if (type == QStringLiteral("Int32Array"))
+    appendElements<qint32>(data, length, values);
+  else if (type == QStringLiteral("Uint32Array"))
+    appendElements<quint32>(data, length, values);
+  else if (type == QStringLiteral("Int16Array"))
+    appendElements<qint16>(data, length, values);
+  else if (type == QStringLiteral("Uint16Array"))
+    appendElements<quint16>(data, length, values);
+  else if (type == QStringLiteral("Int8Array"))
+    appendElements<qint8>(data, length, values);
+  else if (type == QStringLiteral("Uint8Array")
+           || type == QStringLiteral("Uint8ClampedArray"))
+    appendElements<quint8>(data, length, values);
+  else
+    return false;
+
+  return true;
+}
+} // namespace
+
+/**
+ * @brief Creates a frame script without a parse function.
+ */
+JSON::FrameScript::FrameScript()
+{
+  m_engine.installExtensions(QJSEngine::ConsoleExtension
+                             | QJSEngine::GarbageCollectionExtension);
+  m_uint8ArrayConstructor
+      = m_engine.globalObject().property(QStringLiteral("Uint8Array"));
+}
+
+/**
+ * @brief Returns @c true if a callable `parse()` function has been loaded.
+ */
+bool JSON::FrameScript::isLoaded() const
+{
+  return m_parseFunction.isCallable();
+}
+
+/**
+ * @brief Returns @c true if the loaded script declares a callable
+ *        `parseBatch()` function.
+ */
+bool JSON::FrameScript::hasBatchParser() const
+{
+  return isLoaded() && m_parseBatchFunction.isCallable();
+}
+
+/**
+ * @brief Returns a description of the last error of `load()`.
+ */
+QString JSON::FrameScript::errorString() const
+{
+  return m_error;
+}
+
+/**
+ * @brief Executes the `parse()` function of the script over the given
+ *        @a frame.
+ *
+ * If no script is loaded or if the function throws an exception, @a ok (if
+ * given) is set to @c false.
+ *
+ * @return The values returned by the function, or an empty list if no script
+ *         is loaded.
+ */
+QStringList JSON::FrameScript::parse(const QString &frame, bool *ok)
+{
+  return call(QJSValue(frame), ok);
+}
+
+/**
+ * @brief Executes the `parse()` function of the script over the given binary
+ *        @a frame, which is passed as a `Uint8Array`.
+ *
+ * If no script is loaded or if the function throws an exception, @a ok (if
+ * given) is set to @c false.
+ *
+ * @return The values returned by the function, or an empty list if no script
+ *         is loaded.
+ */
+QStringList JSON::FrameScript::parse(const QByteArray &frame, bool *ok)
+{
+  // Only create the array if there is a function to pass it to
+  return call(isLoaded() ? toUint8Array(frame) : QJSValue(), ok);
+}
+
+/**
+ * @brief Executes the `parseBatch()` function of the script over the given
+ *        @a frames with a single call.
+ *
+ * The numbers returned by the function are stored in @a values, and
+ * @a stride is set to the number of values of each frame, so that the values
+ * of the n-th frame start at `values[n * stride]`.
+ *
+ * @return @c false if the function is not declared, if it throws an
+ *         exception or if it does not return the same number of values for
+ *         each frame.
+ */
+bool JSON::FrameScript::parseBatch(const QStringList &frames,
+                                   QVector<double> &values, qsizetype &stride)
+{
+  stride = 0;
+  values.clear();
+  if (!hasBatchParser() || frames.isEmpty())
+    return false;
+
+  return callBatch(m_engine.toScriptValue(frames), frames.size(), values,
+                   stride);
+}
+
+/**
+ * @brief Executes the `parseBatch()` function of the script over the given
+ *        binary @a frames with a single call, each frame is passed as a
+ *        `Uint8Array`.
+ *
+ * @see parseBatch(const QStringList &, QVector<double> &, qsizetype &)
+ */
+bool JSON::FrameScript::parseBatch(const QByteArrayList &frames,
+                                   QVector<double> &values, qsizetype &stride)
+{
+  // Validate arguments
+  stride = 0;
+  values.clear();
+  if (!hasBatchParser() || frames.isEmpty())
+    return false;
+
+  // Create an array with the frames
+  auto array = m_engine.newArray(static_cast<uint>(frames.size()));
+  for (qsizetype i = 0; i < frames.size(); ++i)
+    array.setProperty(static_cast<quint32>(i), toUint8Array(frames.at(i)));
+
+  return callBatch(array, frames.size(), values, stride);
+}
+
+/**
+ * @brief Evaluates the given @a script and looks up its `parse()` function.
+ *
+ * The `parse()` & `parseBatch()` functions of the previous script are removed
+ * from the engine first, so that they are not found if the new script does
+ * not declare them. Other global variables of the previous script are kept,
+ * use a new instance to evaluate a script in a clean engine.
+ *
+ * @return @c true if the script declares a callable `parse()` function.
+ */
+bool JSON::FrameScript::load(const QString &script)
+{
+  // Discard the current parse functions
+  clear();
+  auto global = m_engine.globalObject();
+  (void)global.deleteProperty(QStringLiteral("parse"));
+  (void)global.deleteProperty(QStringLiteral("parseBatch"));
+
+  // Evaluate the script
+  QStringList exceptions;
+  const auto result = m_engine.evaluate(script, QString(), 1, &exceptions);
+  if (result.isError())
+  {
+    m_error = result.toString();
+    return false;
+  }
+
+  // Obtain the parse function
+  auto function = m_engine.globalObject().property(QStringLiteral("parse"));
+  if (!function.isCallable())
+  {
+    m_error = QObject::tr("The 'parse' function is not declared or is not "
+                          "callable!");
+    return false;
+  }
+
+  // Obtain the optional batch parse function
+  m_parseFunction = function;
+  m_parseBatchFunction
+      = m_engine.globalObject().property(QStringLiteral("parseBatch"));
+  return true;
+}
+
+/**
+ * @brief Creates a `Uint8Array` with the bytes of the given @a frame.
+ *
+ * The engine converts the frame to an `ArrayBuffer` with a single copy of
+ * its bytes, so the script receives the binary data without encoding it as
+ * hexadecimal or Base64 text first.
+ */
+QJSValue JSON::FrameScript::toUint8Array(const QByteArray &frame)
+{
+  QJSValueList args;
+  args << m_engine.toScriptValue(frame);
+  return m_uint8ArrayConstructor.callAsConstructor(args);
+}
+
+/**
+ * @brief Calls the `parse()` function with the given @a frame and converts
+ *        its result to a list of strings.
+ *
+ * If no script is loaded or if the function throws an exception, @a ok (if
+ * given) is set to @c false.
+ */
+QStringList JSON::FrameScript::call(const QJSValue &frame, bool *ok)
+{
+  if (ok)
+    *ok = isLoaded();
+
+  if (!isLoaded())
+    return {};
+
+  QJSValueList args;
+  args << frame;
+  const auto result = m_parseFunction.call(args);
+  if (ok)
+    *ok = !result.isError();
+
+  return result.toVariant().toStringList();
+}
+
+/**
+ * @brief Calls the `parseBatch()` function with the given array of @a count
+ *        @a frames, and stores the returned numbers in @a values.
+ *
+ * @return @c false if the function throws an exception or if it does not
+ *         return the same number of values for each frame.
+ */
+bool JSON::FrameScript::callBatch(const QJSValue &frames,
+                                  const qsizetype count,
+                                  QVector<double> &values, qsizetype &stride)
+{
+  // Call the function with the array of frames
+  QJSValueList args;
+  args << frames;
+  const auto result = m_parseBatchFunction.call(args);
+  if (result.isError() || !readNumbers(result, values))
+  {
+    values.clear();
+    return false;
+  }
+
+  // Every frame must produce the same number of values
+  if (values.size() % count != 0)
+  {
+    values.clear();
+    return false;
+  }
+
+  stride = values.size() / count;
+  return true;
+}
+
+/**
+ * @brief Discards the loaded parse function.
+ */
+void JSON::FrameScript::clear()
+{
+  m_error.clear();
+  m_parseFunction = QJSValue();
+  m_parseBatchFunction = QJSValue();
+}
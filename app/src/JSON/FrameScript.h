@@ -0,0 +1,87 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <QVector>
+#include <QString>
+#include <QJSValue>
+#include <QJSEngine>
+#include <QStringList>
+#include <QByteArrayList>
+
+namespace JSON
+{
+/**
+ * @class JSON::FrameScript
+ * @brief Runs the frame parser function of a project without an editor.
+ *
+ * `JSON::FrameParser` is a QML item that embeds the code editor of the
+ * project editor. This class only holds the JavaScript engine, so that frames
+ * can be parsed outside of the main thread by the workers of
+ * `JSON::ParserPool`, whether the editor has been created or not.
+ * Errors are reported through `errorString()` instead of message boxes.
+ *
+ * Scripts may also declare an optional `parseBatch(frames)` function. It is
+ * called once with an array of frames, and returns a flat array of numbers
+ * (or a typed array, e.g. `Float64Array`) with the same number of values for
+ * each frame. This avoids one call & one array conversion per frame.
+ *
+ * Binary frames are passed to both functions as a `Uint8Array` with the
+ * frame bytes, instead of a string with their hexadecimal or Base64 text.
+ */
+class FrameScript
+{
+public:
+  FrameScript();
+
+  FrameScript(FrameScript &&) = delete;
+  FrameScript(const FrameScript &) = delete;
+  FrameScript &operator=(FrameScript &&) = delete;
+  FrameScript &operator=(const FrameScript &) = delete;
+
+  [[nodiscard]] bool isLoaded() const;
+  [[nodiscard]] bool hasBatchParser() const;
+  [[nodiscard]] QString errorString() const;
+  [[nodiscard]] QStringList parse(const QString &frame, bool *ok = nullptr);
+  [[nodiscard]] QStringList parse(const QByteArray &frame, bool *ok = nullptr);
+  [[nodiscard]] bool parseBatch(const QStringList &frames,
+                                QVector<double> &values, qsizetype &stride);
+  [[nodiscard]] bool parseBatch(const QByteArrayList &frames,
+                                QVector<double> &values, qsizetype &stride);
+
+  bool load(const QString &script);
+  void clear();
+
+private:
+  [[nodiscard]] QJSValue toUint8Array(const QByteArray &frame);
+  [[nodiscard]] QStringList call(const QJSValue &frame, bool *ok);
+  [[nodiscard]] bool callBatch(const QJSValue &frames, const qsizetype count,
+                               QVector<double> &values, qsizetype &stride);
+
+private:
+  QString m_error;
+  QJSEngine m_engine;
+  QJSValue m_parseFunction;
+  QJSValue m_parseBatchFunction;
+  QJSValue m_uint8ArrayConstructor;
+};
+} // namespace JSON
@@ -51,6 +51,7 @@ static QVariant SAFE_READ(const QJsonObject &object, const QString &key,
  */
 JSON::Group::Group(const int groupId)
   : m_groupId(groupId)
+  , m_sourceId(0)
   , m_title("")
   , m_widget("")
 {
@@ -69,9 +70,10 @@ JSON::Group::~Group()
  * @brief Serializes the group information and its associated datasets into a
  * QJsonObject.
  *
- * This function encodes the group's properties (title and widget) and each
- * dataset within the group into a JSON object. Calls the `encode()` method for
- * each dataset to ensure that all dataset details are properly serialized.
+ * This function encodes the group's properties (title, widget and source) and
+ * each dataset within the group into a JSON object. Calls the `encode()`
+ * method for each dataset to ensure that all dataset details are properly
+ * serialized.
  *
  * @return A QJsonObject containing the group's properties and an array of
  * encoded datasets.
@@ -85,6 +87,7 @@ QJsonObject JSON::Group::serialize() const
   QJsonObject object;
   object.insert(QStringLiteral("title"), m_title.simplified());
   object.insert(QStringLiteral("widget"), m_widget.simplified());
+  object.insert(QStringLiteral("source"), m_sourceId);
   object.insert(QStringLiteral("datasets"), datasetArray);
   return object;
 }
@@ -103,12 +106,14 @@ bool JSON::Group::read(const QJsonObject &object)
     const auto array = object.value(QStringLiteral("datasets")).toArray();
     const auto title = SAFE_READ(object, "title", "").toString().simplified();
     const auto widget = SAFE_READ(object, "widget", "").toString().simplified();
+    const auto source = SAFE_READ(object, "source", 0).toInt();
     // clang-format on
 
     if (!title.isEmpty() && !array.isEmpty())
     {
       m_title = title;
       m_widget = widget;
+      m_sourceId = qMax(0, source);
       m_datasets.clear();
       m_datasets.squeeze();
 
@@ -156,6 +161,16 @@ int JSON::Group::groupId() const
   return m_groupId;
 }
 
+/**
+ * @return The data source that provides the values of the datasets of this
+ *         group, 0 being the main device. Dataset indexes refer to the fields
+ *         of the frames of that source.
+ */
+int JSON::Group::sourceId() const
+{
+  return m_sourceId;
+}
+
 /**
  * @return The number of datasets inside this group
  */
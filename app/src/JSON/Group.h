@@ -53,12 +53,20 @@ namespace JSON
  * A group contains the following properties:
  * - Title
  * - Widget
+ * - Data source
  * - A vector of datasets
  */
 class FrameBuilder;
 class Group
 {
 public:
+  /**
+   * Once a project is loaded, the dataset indexes of groups that read from an
+   * additional data source are offset by this value times the source number,
+   * so that datasets of different sources never share the same index.
+   */
+  static constexpr int kSourceIndexStride = 10000;
+
   Group(const int groupId = -1);
   ~Group();
 
@@ -66,6 +74,7 @@ public:
   [[nodiscard]] bool read(const QJsonObject &object);
 
   [[nodiscard]] int groupId() const;
+  [[nodiscard]] int sourceId() const;
   [[nodiscard]] int datasetCount() const;
   [[nodiscard]] const QString &title() const;
   [[nodiscard]] const QString &widget() const;
@@ -74,6 +83,7 @@ public:
 
 private:
   int m_groupId;
+  int m_sourceId;
   QString m_title;
   QString m_widget;
   QVector<JSON::Dataset> m_datasets;
@@ -0,0 +1,403 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+
+#include "JSON/ParserPool.h"
+
+#include <memory>
+
+#include <QCoreApplication>
+
+#include "JSON/FrameScript.h"
+
+namespace
+{
+/**
+ * @brief Number of frames submitted to the workers that have not been
+ *        delivered yet above which the pool is saturated.
+ */
+constexpr qsizetype MAX_PENDING_FRAMES = 4096;
+} // namespace
+
+namespace JSON
+{
+/**
+ * @brief Parses chunks of frames on the thread of a parser pool worker.
+ *
+ * The JavaScript engine is created by `load()`, so that it lives in the worker
+ * thread, which is the only thread that uses it. Each script is evaluated in
+ * a new engine, so that no global of the previous script is left behind.
+ */
+class ParserWorker : public QObject
+{
+public:
+  void load(const QString &script)
+  {
+    m_script = std::make_unique<JSON::FrameScript>();
+    (void)m_script->load(script);
+  }
+
+  void clear()
+  {
+    if (m_script)
+      m_script->clear();
+  }
+
+  void parse(ParseJob &job)
+  {
+    if (!job.binaryFrames.isEmpty())
+      parse(job, job.binaryFrames);
+    else
+      parse(job, job.frames);
+  }
+
+private:
+  template<typename List>
+  void parse(ParseJob &job, List &frames)
+  {
+    // Parse the whole chunk with a single call if the script allows it
+    if (m_script && m_script->hasBatchParser())
+    {
+      if (!m_script->parseBatch(frames, job.values, job.stride))
+        job.errors = frames.size();
+
+      frames.clear();
+      return;
+    }
+
+    // Call the parse function for each frame
+    job.fields.reserve(frames.size());
+    for (const auto &frame : std::as_const(frames))
+    {
+      bool ok = false;
+      if (m_script)
+        job.fields.append(m_script->parse(frame, &ok));
+      else
+        job.fields.append(QStringList());
+
+      if (!ok)
+        ++job.errors;
+    }
+
+    frames.clear();
+  }
+
+private:
+  std::unique_ptr<JSON::FrameScript> m_script;
+};
+} // namespace JSON
+
+/**
+ * @brief Creates a worker thread for each CPU core.
+ */
+JSON::ParserPool::ParserPool(QObject *parent)
+  : QObject(parent)
+  , m_loaded(false)
+  , m_parallelParsing(false)
+  , m_nextWorker(0)
+  , m_pendingFrames(0)
+  , m_nextSequence(0)
+  , m_deliverSequence(0)
+{
+  const auto count = qMax(1, QThread::idealThreadCount());
+  for (int i = 0; i < count; ++i)
+  {
+    auto *thread = new QThread(this);
+    auto *worker = new ParserWorker();
+    worker->moveToThread(thread);
+    connect(thread, &QThread::finished, worker, &QObject::deleteLater);
+
+    thread->setObjectName(QStringLiteral("Frame Parser %1").arg(i + 1));
+    thread->start();
+
+    m_threads.append(thread);
+    m_workers.append(worker);
+  }
+
+  if (qApp)
+    connect(qApp, &QCoreApplication::aboutToQuit, this,
+            &JSON::ParserPool::stop);
+}
+
+/**
+ * @brief Stops the worker threads.
+ */
+JSON::ParserPool::~ParserPool()
+{
+  stop();
+}
+
+/**
+ * @brief Returns @c true if a parse function is loaded and frames can be
+ *        submitted to the workers.
+ */
+bool JSON::ParserPool::isLoaded() const
+{
+  return m_loaded && !m_workers.isEmpty();
+}
+
+/**
+ * @brief Returns the number of worker threads of the pool.
+ */
+int JSON::ParserPool::workerCount() const
+{
+  return m_workers.count();
+}
+
+/**
+ * @brief Returns @c true if the frames of a data source are split among all
+ *        the workers, instead of being parsed by a single worker.
+ */
+bool JSON::ParserPool::parallelParsing() const
+{
+  return m_parallelParsing;
+}
+
+/**
+ * @brief Returns @c true if too many frames are waiting to be parsed, no more
+ *        frames should be submitted until `capacityAvailable()` is emitted.
+ */
+bool JSON::ParserPool::isSaturated() const
+{
+  return m_pendingFrames >= MAX_PENDING_FRAMES;
+}
+
+/**
+ * @brief Returns the number of submitted frames that were not delivered with
+ *        `framesParsed()` yet.
+ */
+qsizetype JSON::ParserPool::pendingFrames() const
+{
+  return m_pendingFrames;
+}
+
+/**
+ * @brief Returns a description of the last error of `load()`.
+ */
+QString JSON::ParserPool::errorString() const
+{
+  return m_error;
+}
+
+/**
+ * @brief Validates the given @a script & loads it into every worker.
+ *
+ * Frames submitted before this call are parsed with the previous function,
+ * frames submitted afterwards are parsed with the new one.
+ *
+ * @return @c true if the script declares a callable `parse()` function.
+ */
+bool JSON::ParserPool::load(const QString &script)
+{
+  // Validate the script before handing it over to the workers
+  JSON::FrameScript validator;
+  if (!validator.load(script))
+  {
+    m_error = validator.errorString();
+    clear();
+    return false;
+  }
+
+  // Compile the parse function in each worker
+  m_error.clear();
+  m_loaded = true;
+  for (auto *worker : std::as_const(m_workers))
+  {
+    QMetaObject::invokeMethod(
+        worker, [worker, script] { worker->load(script); },
+        Qt::QueuedConnection);
+  }
+
+  return true;
+}
+
+/**
+ * @brief Splits the given @a frames in chunks & distributes them among the
+ *        workers.
+ *
+ * The frames are delivered through `framesParsed()` together with their
+ * ingress @a timestamps and their data @a source once they, and every frame
+ * submitted before them, have been parsed.
+ *
+ * Frames are always accepted while a parse function is loaded, even if the
+ * pool is saturated, so that frames that were already taken from the frame
+ * readers are never lost.
+ *
+ * @return @c false if the frames were discarded because no parse function
+ *         is loaded.
+ */
+bool JSON::ParserPool::submit(const QStringList &frames,
+                              const QVector<qint64> &timestamps,
+                              const int source)
+{
+  return submitChunks(frames, timestamps, source, &ParseJob::frames);
+}
+
+/**
+ * @brief Splits the given binary @a frames in chunks & distributes them among
+ *        the workers, which pass each frame to the script as a `Uint8Array`.
+ *
+ * The frames are only shared with the workers, their bytes are not copied
+ * until they are handed over to the JavaScript engine.
+ *
+ * @see submit(const QStringList &, const QVector<qint64> &, const int)
+ */
+bool JSON::ParserPool::submit(const QByteArrayList &frames,
+                              const QVector<qint64> &timestamps,
+                              const int source)
+{
+  return submitChunks(frames, timestamps, source, &ParseJob::binaryFrames);
+}
+
+/**
+ * @brief Splits the given @a frames in chunks, stores each chunk in the
+ *        given @a member of a job and posts the jobs to the workers.
+ *
+ * Without parallel parsing, the frames are posted as a single job to the
+ * worker that parses every frame of the given @a source.
+ */
+template<typename List>
+bool JSON::ParserPool::submitChunks(const List &frames,
+                                    const QVector<qint64> &timestamps,
+                                    const int source, List ParseJob::*member)
+{
+  // Validate arguments
+  Q_ASSERT(frames.size() == timestamps.size());
+  if (frames.isEmpty())
+    return true;
+
+  // Reject the frames if there is nothing to parse them with
+  if (!isLoaded())
+    return false;
+
+  // Split the frames in one chunk per worker at most
+  const qsizetype count = frames.size();
+  qsizetype chunkSize = count;
+  if (m_parallelParsing)
+  {
+    const qsizetype chunks = qMin<qsizetype>(m_workers.size(), count);
+    chunkSize = (count + chunks - 1) / chunks;
+  }
+
+  for (qsizetype first = 0; first < count; first += chunkSize)
+  {
+    // Number the frames of the chunk
+    ParseJob job;
+    job.source = source;
+    job.sequence = m_nextSequence;
+    job.*member = frames.mid(first, chunkSize);
+    job.timestamps = timestamps.mid(first, chunkSize);
+    m_nextSequence += job.timestamps.size();
+    m_pendingFrames += job.timestamps.size();
+
+    // Select the next worker, or the worker of the source
+    ParserWorker *worker = nullptr;
+    if (m_parallelParsing)
+    {
+      worker = m_workers[m_nextWorker];
+      m_nextWorker = (m_nextWorker + 1) % m_workers.size();
+    }
+    else
+      worker = m_workers[qMax(0, source) % m_workers.size()];
+
+    // Parse the chunk & send it back to the thread of the pool
+    QMetaObject::invokeMethod(
+        worker,
+        [this, worker, job]() mutable {
+          worker->parse(job);
+          QMetaObject::invokeMethod(
+              this, [this, job]() mutable { onJobFinished(job); },
+              Qt::QueuedConnection);
+        },
+        Qt::QueuedConnection);
+  }
+
+  return true;
+}
+
+/**
+ * @brief Stops the worker threads, frames that have not been parsed yet are
+ *        discarded.
+ */
+void JSON::ParserPool::stop()
+{
+  m_loaded = false;
+  m_workers.clear();
+
+  for (auto *thread : std::as_const(m_threads))
+  {
+    thread->quit();
+    if (!thread->wait(100))
+      thread->terminate();
+  }
+
+  qDeleteAll(m_threads);
+  m_threads.clear();
+}
+
+/**
+ * @brief Discards the parse function of every worker.
+ */
+void JSON::ParserPool::clear()
+{
+  m_loaded = false;
+  for (auto *worker : std::as_const(m_workers))
+  {
+    QMetaObject::invokeMethod(
+        worker, [worker] { worker->clear(); }, Qt::QueuedConnection);
+  }
+}
+
+/**
+ * @brief Enables or disables splitting the frames of a data source among all
+ *        the workers.
+ *
+ * Parallel parsing scales with the number of cores, but each worker has its
+ * own copy of the global variables of the script, so it is only suitable
+ * for parse functions that do not keep state between frames.
+ */
+void JSON::ParserPool::setParallelParsing(const bool enabled)
+{
+  m_parallelParsing = enabled;
+}
+
+/**
+ * @brief Stores the given parsed @a job and delivers every chunk that is
+ *        next in sequence order.
+ *
+ * Emits `capacityAvailable()` if delivering the chunks ended the saturation
+ * of the pool.
+ */
+void JSON::ParserPool::onJobFinished(ParseJob &job)
+{
+  const bool saturated = isSaturated();
+  m_finished.insert(job.sequence, std::move(job));
+  while (!m_finished.isEmpty() && m_finished.firstKey() == m_deliverSequence)
+  {
+    const auto next = m_finished.take(m_deliverSequence);
+    m_deliverSequence += next.timestamps.size();
+    m_pendingFrames -= next.timestamps.size();
+    Q_EMIT framesParsed(next);
+  }
+
+  if (saturated && !isSaturated())
+    Q_EMIT capacityAvailable();
+}
@@ -0,0 +1,140 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+
+#pragma once
+
+#include <QMap>
+#include <QObject>
+#include <QThread>
+#include <QVector>
+#include <QStringList>
+#include <QByteArrayList>
+
+namespace JSON
+{
+class ParserWorker;
+
+/**
+ * @brief A chunk of consecutive frames parsed by a worker of the parser pool.
+ *
+ * @c sequence is the sequence number of the first frame of the chunk, the
+ * rest of the frames are numbered consecutively.
+ *
+ * Text frames are stored in @c frames, frames of projects that use the binary
+ * decoder method are stored in @c binaryFrames with their original bytes.
+ *
+ * Frames parsed by the `parse()` function of the script have their fields in
+ * @c fields. Frames parsed by the `parseBatch()` function leave @c fields
+ * empty, the values of the n-th frame start at `values[n * stride]` instead.
+ */
+struct ParseJob
+{
+  quint64 sequence = 0;
+  int source = 0;
+  quint64 errors = 0;
+  qsizetype stride = 0;
+  QStringList frames;
+  QByteArrayList binaryFrames;
+  QVector<double> values;
+  QVector<qint64> timestamps;
+  QVector<QStringList> fields;
+};
+
+/**
+ * @brief The ParserPool class
+ *
+ * Runs the frame parser function of the project on a pool of worker threads,
+ * one per CPU core, each with its own headless JavaScript engine (see
+ * `JSON::FrameScript`). This way, parsing scales with the number of cores and
+ * does not compete with the user interface for the main thread.
+ *
+ * Submitted frames are numbered with a sequence number. By default, all the
+ * frames of a data source are parsed by the same worker, so that the global
+ * variables of the script keep their state between the frames of a source.
+ * Projects that do not rely on such state may enable parallel parsing (see
+ * `setParallelParsing()`), the frames are then split in chunks of consecutive
+ * frames, which are distributed round-robin among the workers. Parsed chunks
+ * are reassembled in sequence order before `framesParsed()` is emitted, so
+ * frames are always delivered in the order they were received.
+ *
+ * When the workers cannot keep up with the incoming data, the pool becomes
+ * saturated (see `isSaturated()`). Callers are expected to stop submitting
+ * frames until `capacityAvailable()` is emitted, so that the frames wait in
+ * the frame reader queues, which apply the backpressure policy of the user,
+ * instead of being discarded by the pool.
+ */
+class ParserPool : public QObject
+{
+  Q_OBJECT
+
+signals:
+  void capacityAvailable();
+  void framesParsed(const JSON::ParseJob &job);
+
+public:
+  explicit ParserPool(QObject *parent = nullptr);
+  ~ParserPool();
+
+  ParserPool(ParserPool &&) = delete;
+  ParserPool(const ParserPool &) = delete;
+  ParserPool &operator=(ParserPool &&) = delete;
+  ParserPool &operator=(const ParserPool &) = delete;
+
+  [[nodiscard]] bool isLoaded() const;
+  [[nodiscard]] bool isSaturated() const;
+  [[nodiscard]] int workerCount() const;
+  [[nodiscard]] bool parallelParsing() const;
+  [[nodiscard]] qsizetype pendingFrames() const;
+  [[nodiscard]] QString errorString() const;
+
+  bool load(const QString &script);
+  bool submit(const QStringList &frames, const QVector<qint64> &timestamps,
+              const int source);
+  bool submit(const QByteArrayList &frames, const QVector<qint64> &timestamps,
+              const int source);
+
+public slots:
+  void stop();
+  void clear();
+  void setParallelParsing(const bool enabled);
+
+private:
+  template<typename List>
+  bool submitChunks(const List &frames, const QVector<qint64> &timestamps,
+                    const int source, List ParseJob::*member);
+  void onJobFinished(ParseJob &job);
+
+private:
+  bool m_loaded;
+  bool m_parallelParsing;
+  QString m_error;
+
+  int m_nextWorker;
+  qsizetype m_pendingFrames;
+  quint64 m_nextSequence;
+  quint64 m_deliverSequence;
+  QMap<quint64, ParseJob> m_finished;
+
+  QVector<QThread *> m_threads;
+  QVector<ParserWorker *> m_workers;
+};
+} // namespace JSON
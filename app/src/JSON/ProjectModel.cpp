@@ -31,6 +31,7 @@
 #include "Misc/Utilities.h"
 #include "Misc/Translator.h"
 
+#include "IO/Console.h"
 #include "JSON/FrameParser.h"
 #include "JSON/ProjectModel.h"
 #include "JSON/FrameBuilder.h"
@@ -61,6 +62,17 @@ typedef enum
   kProjectView_FrameEndSequence,    /**< Represents the frame end sequence. */
   kProjectView_FrameDecoder,        /**< Represents the frame decoder item. */
   kProjectView_FrameDetection,      /**< Represents the frame detection item. */
+  kProjectView_Checksum,            /**< Represents the checksum algorithm. */
+  kProjectView_SyncWord,            /**< Represents the frame sync word. */
+  kProjectView_LengthOffset,        /**< Represents the length field offset. */
+  kProjectView_LengthSize,          /**< Represents the length field size. */
+  kProjectView_ByteOrder,           /**< Represents the length byte order. */
+  kProjectView_MaxFrameLength,      /**< Represents the max. payload length. */
+  kProjectView_ParserMethod,        /**< Represents the frame parser method. */
+  kProjectView_FieldSeparator,      /**< Represents the native separator. */
+  kProjectView_QuoteCharacter,      /**< Represents the field quote char. */
+  kProjectView_TrimFields,          /**< Represents the field trimming flag. */
+  kProjectView_ParallelParsing,     /**< Represents the parallel parser flag. */
   kProjectView_ThunderforestApiKey, /**< Represents the Thunderforest API key. */
   kProjectView_MapTilerApiKey       /**< Represents the MapTiler API key. */
 } ProjectItem;
@@ -86,7 +98,14 @@ typedef enum
   kDatasetView_FFT_Samples,      /**< FFT window size item. */
   kDatasetView_FFT_SamplingRate, /**< FFT sampling rate item. */
   kDatasetView_xAxis,            /**< Plot X axis item. */
-  kDatasetView_Overview          /**< Display in Overview workspace. */
+  kDatasetView_Overview,         /**< Display in Overview workspace. */
+  kDatasetView_BinaryType,       /**< Binary field type item. */
+  kDatasetView_BinaryOffset,     /**< Binary field byte offset item. */
+  kDatasetView_BinaryByteOrder,  /**< Binary field byte order item. */
+  kDatasetView_BinaryBitOffset,  /**< Binary bitfield first bit item. */
+  kDatasetView_BinaryBitWidth,   /**< Binary bitfield width item. */
+  kDatasetView_BinaryScale,      /**< Binary field scale factor item. */
+  kDatasetView_BinaryValueOffset /**< Binary field value offset item. */
 } DatasetItem;
 // clang-format on
 
@@ -111,7 +130,8 @@ typedef enum
 typedef enum
 {
   kGroupView_Title,  /**< Represents the group title item. */
-  kGroupView_Widget  /**< Represents the group widget item. */
+  kGroupView_Widget, /**< Represents the group widget item. */
+  kGroupView_Source  /**< Represents the group data source item. */
 } GroupItem;
 // clang-format on
 
@@ -141,9 +161,20 @@ JSON::ProjectModel::ProjectModel()
   , m_frameParserCode("")
   , m_frameEndSequence("")
   , m_frameStartSequence("")
+  , m_syncWord("")
+  , m_lengthOffset(0)
+  , m_lengthSize(1)
+  , m_lengthBigEndian(true)
+  , m_maxFrameLength(1024)
+  , m_fieldSeparator(",")
+  , m_quoteCharacter("")
+  , m_trimFields(true)
+  , m_parallelParsing(false)
   , m_currentView(ProjectView)
   , m_frameDecoder(SerialStudio::PlainText)
   , m_frameDetection(SerialStudio::EndDelimiterOnly)
+  , m_checksumAlgorithm(SerialStudio::AutoDetectChecksum)
+  , m_parserMethod(SerialStudio::ScriptParser)
   , m_modified(false)
   , m_filePath("")
   , m_treeModel(nullptr)
@@ -236,7 +267,7 @@ JSON::ProjectModel::CurrentView JSON::ProjectModel::currentView() const
  *
  * This function returns the decoder method currently set for parsing data
  * frames. The decoder method determines how incoming data is interpreted
- * (e.g., as normal UTF-8, hexadecimal, or Base64).
+ * (e.g., as normal UTF-8, hexadecimal, Base64 or raw bytes).
  *
  * @return The current decoder method as a value from the `DecoderMethod` enum.
  */
@@ -258,6 +289,76 @@ SerialStudio::FrameDetection JSON::ProjectModel::frameDetection() const
   return m_frameDetection;
 }
 
+/**
+ * @brief Retrieves the checksum algorithm used to validate received frames.
+ *
+ * The checksum trailer is expected right after the frame end delimiter. This
+ * setting is fixed for the whole project, so that the frame reader does not
+ * need to look for every known trailer type on each frame.
+ *
+ * @return The current checksum algorithm as a value from the
+ *         `ChecksumAlgorithm` enum.
+ */
+SerialStudio::ChecksumAlgorithm JSON::ProjectModel::checksumAlgorithm() const
+{
+  return m_checksumAlgorithm;
+}
+
+/**
+ * @brief Retrieves the header layout of length-prefixed binary frames.
+ *
+ * The sync word is stored as a hexadecimal string in the project file and is
+ * converted to raw bytes here.
+ *
+ * @return The sync word, length field layout & maximum payload length used by
+ *         the `LengthPrefixed` frame detection mode.
+ */
+IO::LengthPrefixFormat JSON::ProjectModel::lengthPrefixFormat() const
+{
+  IO::LengthPrefixFormat format;
+  format.syncWord = IO::Console::hexToBytes(m_syncWord);
+  format.lengthOffset = m_lengthOffset;
+  format.lengthSize = m_lengthSize;
+  format.bigEndian = m_lengthBigEndian;
+  format.maxLength = m_maxFrameLength;
+  return format;
+}
+
+/**
+ * @brief Retrieves the method used to obtain the fields of each frame.
+ *
+ * @return `ScriptParser` if frames are parsed by the JavaScript frame parser
+ *         function, `NativeSeparator` if they are split natively according
+ *         to `fieldSplitterFormat()`, `BinaryStruct` if the binary field of
+ *         each dataset is decoded from the frame bytes.
+ */
+SerialStudio::ParserMethod JSON::ProjectModel::parserMethod() const
+{
+  return m_parserMethod;
+}
+
+/**
+ * @brief Returns @c true if the frames of each data source may be split among
+ *        several frame parser workers.
+ *
+ * Disabled by default, so that the global variables of the frame parser
+ * function keep their state between the frames of a data source.
+ */
+bool JSON::ProjectModel::parallelParsing() const
+{
+  return m_parallelParsing;
+}
+
+/**
+ * @brief Retrieves the separator, quote character & trimming rule used by
+ *        the `NativeSeparator` parser method.
+ */
+JSON::FieldSplitterFormat JSON::ProjectModel::fieldSplitterFormat() const
+{
+  return JSON::FieldSplitterFormat::fromProject(m_fieldSeparator,
+                                                m_quoteCharacter, m_trimFields);
+}
+
 //------------------------------------------------------------------------------
 // Document information functions
 //------------------------------------------------------------------------------
@@ -806,12 +907,24 @@ bool JSON::ProjectModel::saveJsonFile(const bool askPath)
   QJsonObject json;
   json.insert("title", m_title);
   json.insert("decoder", m_frameDecoder);
+  json.insert("checksum", m_checksumAlgorithm);
   json.insert("frameEnd", m_frameEndSequence);
   json.insert("frameParser", m_frameParserCode);
   json.insert("frameDetection", m_frameDetection);
   json.insert("frameStart", m_frameStartSequence);
+  json.insert("syncWord", m_syncWord);
+  json.insert("lengthSize", m_lengthSize);
+  json.insert("lengthOffset", m_lengthOffset);
+  json.insert("maxFrameLength", m_maxFrameLength);
+  json.insert("lengthBigEndian", m_lengthBigEndian);
+  json.insert("parserMethod", m_parserMethod);
+  json.insert("fieldSeparator", m_fieldSeparator);
+  json.insert("quoteCharacter", m_quoteCharacter);
+  json.insert("trimFields", m_trimFields);
+  json.insert("parallelParsing", m_parallelParsing);
   json.insert("mapTilerApiKey", m_mapTilerApiKey);
   json.insert("thunderforestApiKey", m_thunderforestApiKey);
+  json.insert("sources", m_sources);
 
   // Create group array
   QJsonArray groupArray;
@@ -910,10 +1023,22 @@ void JSON::ProjectModel::newJsonFile()
   // Reset project properties
   m_frameDecoder = SerialStudio::PlainText;
   m_frameDetection = SerialStudio::EndDelimiterOnly;
+  m_checksumAlgorithm = SerialStudio::AutoDetectChecksum;
   m_frameEndSequence = "\\n";
   m_mapTilerApiKey = "";
   m_thunderforestApiKey = "";
   m_frameStartSequence = "$";
+  m_syncWord = "AA 55";
+  m_lengthOffset = 0;
+  m_lengthSize = 1;
+  m_lengthBigEndian = true;
+  m_maxFrameLength = 1024;
+  m_parserMethod = SerialStudio::ScriptParser;
+  m_fieldSeparator = ",";
+  m_quoteCharacter = "";
+  m_trimFields = true;
+  m_parallelParsing = false;
+  m_sources = QJsonArray();
   m_title = tr("Untitled Project");
   m_frameParserCode = JSON::FrameParser::defaultCode();
 
@@ -937,6 +1062,8 @@ void JSON::ProjectModel::newJsonFile()
   Q_EMIT gpsApiKeysChanged();
   Q_EMIT frameDetectionChanged();
   Q_EMIT frameParserCodeChanged();
+  Q_EMIT checksumAlgorithmChanged();
+  Q_EMIT lengthPrefixFormatChanged();
 
   // Reset modified flag
   setModified(false);
@@ -1018,6 +1145,20 @@ void JSON::ProjectModel::openJsonFile(const QString &path)
       = static_cast<SerialStudio::DecoderMethod>(json.value("decoder").toInt());
   m_frameDetection = static_cast<SerialStudio::FrameDetection>(
       json.value("frameDetection").toInt());
+  m_checksumAlgorithm = static_cast<SerialStudio::ChecksumAlgorithm>(
+      json.value("checksum").toInt());
+  m_syncWord = json.value("syncWord").toString("AA 55");
+  m_lengthSize = json.value("lengthSize").toInt(1);
+  m_lengthOffset = json.value("lengthOffset").toInt(0);
+  m_maxFrameLength = json.value("maxFrameLength").toInt(1024);
+  m_lengthBigEndian = json.value("lengthBigEndian").toBool(true);
+  m_parserMethod = static_cast<SerialStudio::ParserMethod>(
+      json.value("parserMethod").toInt());
+  m_fieldSeparator = json.value("fieldSeparator").toString(",");
+  m_quoteCharacter = json.value("quoteCharacter").toString();
+  m_trimFields = json.value("trimFields").toBool(true);
+  m_parallelParsing = json.value("parallelParsing").toBool(false);
+  m_sources = json.value("sources").toArray();
 
   // Preserve compatibility with previous projects
   if (!json.contains("frameDetection"))
@@ -1099,6 +1240,8 @@ void JSON::ProjectModel::openJsonFile(const QString &path)
   Q_EMIT gpsApiKeysChanged();
   Q_EMIT frameDetectionChanged();
   Q_EMIT frameParserCodeChanged();
+  Q_EMIT checksumAlgorithmChanged();
+  Q_EMIT lengthPrefixFormatChanged();
 }
 
 /**
@@ -1272,6 +1415,7 @@ void JSON::ProjectModel::duplicateCurrentGroup()
   // Initialize a new group
   auto group = JSON::Group(m_groups.count());
   group.m_widget = m_selectedGroup.widget();
+  group.m_sourceId = m_selectedGroup.sourceId();
   group.m_title = tr("%1 (Copy)").arg(m_selectedGroup.title());
   for (auto i = 0; i < m_selectedGroup.m_datasets.count(); ++i)
   {
@@ -2155,19 +2299,93 @@ void JSON::ProjectModel::buildProjectModel()
                  ParameterIcon);
   m_projectModel->appendRow(title);
 
+  // Add frame parser method
+  auto parserMethod = new QStandardItem();
+  parserMethod->setEditable(true);
+  parserMethod->setData(ComboBox, WidgetType);
+  parserMethod->setData(m_parserMethods, ComboBoxData);
+  parserMethod->setData(m_parserMethod, EditableValue);
+  parserMethod->setData(tr("Frame Parser"), ParameterName);
+  parserMethod->setData(kProjectView_ParserMethod, ParameterType);
+  parserMethod->setData(tr("Method used to obtain the fields of each frame"),
+                        ParameterDescription);
+  parserMethod->setData(
+      "qrc:/rcc/icons/project-editor/model/data-conversion.svg", ParameterIcon);
+  m_projectModel->appendRow(parserMethod);
+
   // Add decoding
-  auto decoding = new QStandardItem();
-  decoding->setEditable(true);
-  decoding->setData(ComboBox, WidgetType);
-  decoding->setData(m_decoderOptions, ComboBoxData);
-  decoding->setData(m_frameDecoder, EditableValue);
-  decoding->setData(tr("Data Conversion Method"), ParameterName);
-  decoding->setData(kProjectView_FrameDecoder, ParameterType);
-  decoding->setData(tr("Input data format for frame parser"),
-                    ParameterDescription);
-  decoding->setData("qrc:/rcc/icons/project-editor/model/data-conversion.svg",
-                    ParameterIcon);
-  m_projectModel->appendRow(decoding);
+  if (m_parserMethod == SerialStudio::ScriptParser)
+  {
+    auto decoding = new QStandardItem();
+    decoding->setEditable(true);
+    decoding->setData(ComboBox, WidgetType);
+    decoding->setData(m_decoderOptions, ComboBoxData);
+    decoding->setData(m_frameDecoder, EditableValue);
+    decoding->setData(tr("Data Conversion Method"), ParameterName);
+    decoding->setData(kProjectView_FrameDecoder, ParameterType);
+    decoding->setData(tr("Input data format for frame parser"),
+                      ParameterDescription);
+    decoding->setData(
+        "qrc:/rcc/icons/project-editor/model/data-conversion.svg",
+        ParameterIcon);
+    m_projectModel->appendRow(decoding);
+
+    auto parallel = new QStandardItem();
+    parallel->setEditable(true);
+    parallel->setData(CheckBox, WidgetType);
+    parallel->setData(m_parallelParsing, EditableValue);
+    parallel->setData(tr("Parallel Parsing"), ParameterName);
+    parallel->setData(kProjectView_ParallelParsing, ParameterType);
+    parallel->setData(
+        tr("Parse frames on several threads, global variables are not shared"),
+        ParameterDescription);
+    parallel->setData(
+        "qrc:/rcc/icons/project-editor/model/data-conversion.svg",
+        ParameterIcon);
+    m_projectModel->appendRow(parallel);
+  }
+
+  // Add native separator settings
+  if (m_parserMethod == SerialStudio::NativeSeparator)
+  {
+    auto separator = new QStandardItem();
+    separator->setEditable(true);
+    separator->setData(TextField, WidgetType);
+    separator->setData(m_fieldSeparator, EditableValue);
+    separator->setData(tr("Field Separator"), ParameterName);
+    separator->setData(kProjectView_FieldSeparator, ParameterType);
+    separator->setData(QStringLiteral(","), PlaceholderValue);
+    separator->setData(tr("String between two fields, e.g. \\t for tabs"),
+                       ParameterDescription);
+    separator->setData("qrc:/rcc/icons/project-editor/model/end-delimiter.svg",
+                       ParameterIcon);
+    m_projectModel->appendRow(separator);
+
+    auto quote = new QStandardItem();
+    quote->setEditable(true);
+    quote->setData(TextField, WidgetType);
+    quote->setData(m_quoteCharacter, EditableValue);
+    quote->setData(tr("Quote Character"), ParameterName);
+    quote->setData(kProjectView_QuoteCharacter, ParameterType);
+    quote->setData(tr("None"), PlaceholderValue);
+    quote->setData(tr("Encloses fields that contain the separator"),
+                   ParameterDescription);
+    quote->setData("qrc:/rcc/icons/project-editor/model/start-delimiter.svg",
+                   ParameterIcon);
+    m_projectModel->appendRow(quote);
+
+    auto trim = new QStandardItem();
+    trim->setEditable(true);
+    trim->setData(CheckBox, WidgetType);
+    trim->setData(m_trimFields, EditableValue);
+    trim->setData(tr("Trim Whitespace"), ParameterName);
+    trim->setData(kProjectView_TrimFields, ParameterType);
+    trim->setData(tr("Remove spaces around each field"),
+                  ParameterDescription);
+    trim->setData("qrc:/rcc/icons/project-editor/model/title.svg",
+                  ParameterIcon);
+    m_projectModel->appendRow(trim);
+  }
 
   // Add frame detection method
   auto frameDetection = new QStandardItem();
@@ -2219,6 +2437,92 @@ void JSON::ProjectModel::buildProjectModel()
     frameEnd->setData("qrc:/rcc/icons/project-editor/model/end-delimiter.svg",
                       ParameterIcon);
     m_projectModel->appendRow(frameEnd);
+
+    // Add checksum algorithm
+    auto checksum = new QStandardItem();
+    checksum->setEditable(true);
+    checksum->setData(ComboBox, WidgetType);
+    checksum->setData(m_checksumMethods, ComboBoxData);
+    checksum->setData(m_checksumMethodsValues.indexOf(m_checksumAlgorithm),
+                      EditableValue);
+    checksum->setData(tr("Checksum Algorithm"), ParameterName);
+    checksum->setData(kProjectView_Checksum, ParameterType);
+    checksum->setData(tr("Checksum trailer after the end delimiter"),
+                      ParameterDescription);
+    checksum->setData("qrc:/rcc/icons/project-editor/model/end-delimiter.svg",
+                      ParameterIcon);
+    m_projectModel->appendRow(checksum);
+  }
+
+  // Add length-prefixed frame header layout
+  if (m_frameDetection == SerialStudio::LengthPrefixed)
+  {
+    auto syncWord = new QStandardItem();
+    syncWord->setEditable(true);
+    syncWord->setData(HexTextField, WidgetType);
+    syncWord->setData(m_syncWord, EditableValue);
+    syncWord->setData(tr("Sync Word (Hex)"), ParameterName);
+    syncWord->setData(kProjectView_SyncWord, ParameterType);
+    syncWord->setData(QStringLiteral("AA 55"), PlaceholderValue);
+    syncWord->setData(tr("Bytes marking the start of a frame"),
+                      ParameterDescription);
+    syncWord->setData("qrc:/rcc/icons/project-editor/model/start-delimiter.svg",
+                      ParameterIcon);
+    m_projectModel->appendRow(syncWord);
+
+    auto lengthOffset = new QStandardItem();
+    lengthOffset->setEditable(true);
+    lengthOffset->setData(IntField, WidgetType);
+    lengthOffset->setData(m_lengthOffset, EditableValue);
+    lengthOffset->setData(tr("Length Field Offset"), ParameterName);
+    lengthOffset->setData(kProjectView_LengthOffset, ParameterType);
+    lengthOffset->setData(0, PlaceholderValue);
+    lengthOffset->setData(tr("Bytes between the sync word and the length"),
+                          ParameterDescription);
+    lengthOffset->setData("qrc:/rcc/icons/project-editor/model/index.svg",
+                          ParameterIcon);
+    m_projectModel->appendRow(lengthOffset);
+
+    auto lengthSize = new QStandardItem();
+    lengthSize->setEditable(true);
+    lengthSize->setData(ComboBox, WidgetType);
+    lengthSize->setData(m_lengthSizes, ComboBoxData);
+    lengthSize->setData(m_lengthSizesValues.indexOf(m_lengthSize),
+                        EditableValue);
+    lengthSize->setData(tr("Length Field Size"), ParameterName);
+    lengthSize->setData(kProjectView_LengthSize, ParameterType);
+    lengthSize->setData(tr("Width of the payload length field"),
+                        ParameterDescription);
+    lengthSize->setData("qrc:/rcc/icons/project-editor/model/index.svg",
+                        ParameterIcon);
+    m_projectModel->appendRow(lengthSize);
+
+    auto byteOrder = new QStandardItem();
+    byteOrder->setEditable(true);
+    byteOrder->setData(ComboBox, WidgetType);
+    byteOrder->setData(m_byteOrders, ComboBoxData);
+    byteOrder->setData(m_lengthBigEndian ? 0 : 1, EditableValue);
+    byteOrder->setData(tr("Length Byte Order"), ParameterName);
+    byteOrder->setData(kProjectView_ByteOrder, ParameterType);
+    byteOrder->setData(tr("Endianness of the payload length field"),
+                       ParameterDescription);
+    byteOrder->setData(
+        "qrc:/rcc/icons/project-editor/model/data-conversion.svg",
+        ParameterIcon);
+    m_projectModel->appendRow(byteOrder);
+
+    auto maxFrameLength = new QStandardItem();
+    maxFrameLength->setEditable(true);
+    maxFrameLength->setData(IntField, WidgetType);
+    maxFrameLength->setData(m_maxFrameLength, EditableValue);
+    maxFrameLength->setData(tr("Maximum Payload Length"), ParameterName);
+    maxFrameLength->setData(kProjectView_MaxFrameLength, ParameterType);
+    maxFrameLength->setData(1024, PlaceholderValue);
+    maxFrameLength->setData(tr("Longer frames trigger a resynchronization"),
+                            ParameterDescription);
+    maxFrameLength->setData("qrc:/rcc/icons/project-editor/model/max.svg",
+                            ParameterIcon);
+    m_projectModel->appendRow(maxFrameLength);
   }
 
   // Add Thunderforest API Key
@@ -2326,6 +2630,23 @@ void JSON::ProjectModel::buildGroupModel(const JSON::Group &group)
                   ParameterIcon);
   m_groupModel->appendRow(widget);
 
+  // Add data source (only for projects with additional sources)
+  if (!m_sources.isEmpty())
+  {
+    auto source = new QStandardItem();
+    source->setEditable(true);
+    source->setData(IntField, WidgetType);
+    source->setData(group.sourceId(), EditableValue);
+    source->setData(tr("Data Source"), ParameterName);
+    source->setData(kGroupView_Source, ParameterType);
+    source->setData(0, PlaceholderValue);
+    source->setData(tr("Device that provides the values (0 = main device)"),
+                    ParameterDescription);
+    source->setData("qrc:/rcc/icons/project-editor/model/index.svg",
+                    ParameterIcon);
+    m_groupModel->appendRow(source);
+  }
+
   // Handle edits
   connect(m_groupModel, &CustomModel::itemChanged, this,
           &JSON::ProjectModel::onGroupItemChanged);
@@ -2539,6 +2860,107 @@ void JSON::ProjectModel::buildDatasetModel(const JSON::Dataset &dataset)
                  ParameterIcon);
   m_datasetModel->appendRow(units);
 
+  // Add binary field settings
+  if (m_parserMethod == SerialStudio::BinaryStruct)
+  {
+    const auto &binary = dataset.binaryField();
+
+    auto type = new QStandardItem();
+    type->setEditable(true);
+    type->setData(ComboBox, WidgetType);
+    type->setData(m_binaryTypes, ComboBoxData);
+    type->setData(binary.type, EditableValue);
+    type->setData(tr("Binary Type"), ParameterName);
+    type->setData(kDatasetView_BinaryType, ParameterType);
+    type->setData(tr("How the value is stored in the frame"),
+                  ParameterDescription);
+    type->setData("qrc:/rcc/icons/project-editor/model/data-conversion.svg",
+                  ParameterIcon);
+    m_datasetModel->appendRow(type);
+
+    auto offset = new QStandardItem();
+    offset->setEditable(true);
+    offset->setData(IntField, WidgetType);
+    offset->setData(binary.byteOffset, EditableValue);
+    offset->setData(tr("Byte Offset"), ParameterName);
+    offset->setData(kDatasetView_BinaryOffset, ParameterType);
+    offset->setData(0, PlaceholderValue);
+    offset->setData(tr("Position of the first byte of the value"),
+                    ParameterDescription);
+    offset->setData("qrc:/rcc/icons/project-editor/model/index.svg",
+                    ParameterIcon);
+    m_datasetModel->appendRow(offset);
+
+    auto byteOrder = new QStandardItem();
+    byteOrder->setEditable(true);
+    byteOrder->setData(ComboBox, WidgetType);
+    byteOrder->setData(m_byteOrders, ComboBoxData);
+    byteOrder->setData(binary.bigEndian ? 0 : 1, EditableValue);
+    byteOrder->setData(tr("Byte Order"), ParameterName);
+    byteOrder->setData(kDatasetView_BinaryByteOrder, ParameterType);
+    byteOrder->setData(tr("Endianness of multi-byte values"),
+                       ParameterDescription);
+    byteOrder->setData(
+        "qrc:/rcc/icons/project-editor/model/data-conversion.svg",
+        ParameterIcon);
+    m_datasetModel->appendRow(byteOrder);
+
+    if (binary.type == JSON::BinaryField::Bitfield)
+    {
+      auto bitOffset = new QStandardItem();
+      bitOffset->setEditable(true);
+      bitOffset->setData(IntField, WidgetType);
+      bitOffset->setData(binary.bitOffset, EditableValue);
+      bitOffset->setData(tr("First Bit"), ParameterName);
+      bitOffset->setData(kDatasetView_BinaryBitOffset, ParameterType);
+      bitOffset->setData(0, PlaceholderValue);
+      bitOffset->setData(tr("Bit position, starting at the least significant "
+                            "bit (0-63)"),
+                         ParameterDescription);
+      bitOffset->setData("qrc:/rcc/icons/project-editor/model/index.svg",
+                         ParameterIcon);
+      m_datasetModel->appendRow(bitOffset);
+
+      auto bitWidth = new QStandardItem();
+      bitWidth->setEditable(true);
+      bitWidth->setData(IntField, WidgetType);
+      bitWidth->setData(binary.bitWidth, EditableValue);
+      bitWidth->setData(tr("Bit Width"), ParameterName);
+      bitWidth->setData(kDatasetView_BinaryBitWidth, ParameterType);
+      bitWidth->setData(1, PlaceholderValue);
+      bitWidth->setData(tr("Number of bits of the value (1-64)"),
+                        ParameterDescription);
+      bitWidth->setData("qrc:/rcc/icons/project-editor/model/index.svg",
+                        ParameterIcon);
+      m_datasetModel->appendRow(bitWidth);
+    }
+
+    auto scale = new QStandardItem();
+    scale->setEditable(true);
+    scale->setData(FloatField, WidgetType);
+    scale->setData(binary.scale, EditableValue);
+    scale->setData(tr("Scale Factor"), ParameterName);
+    scale->setData(kDatasetView_BinaryScale, ParameterType);
+    scale->setData(1, PlaceholderValue);
+    scale->setData(tr("Multiplies the stored value"), ParameterDescription);
+    scale->setData("qrc:/rcc/icons/project-editor/model/max.svg",
+                   ParameterIcon);
+    m_datasetModel->appendRow(scale);
+
+    auto valueOffset = new QStandardItem();
+    valueOffset->setEditable(true);
+    valueOffset->setData(FloatField, WidgetType);
+    valueOffset->setData(binary.offset, EditableValue);
+    valueOffset->setData(tr("Value Offset"), ParameterName);
+    valueOffset->setData(kDatasetView_BinaryValueOffset, ParameterType);
+    valueOffset->setData(0, PlaceholderValue);
+    valueOffset->setData(tr("Added to the value after scaling"),
+                         ParameterDescription);
+    valueOffset->setData("qrc:/rcc/icons/project-editor/model/min.svg",
+                         ParameterIcon);
+    m_datasetModel->appendRow(valueOffset);
+  }
+
   // Add show in overview method
   bool hasWidget = showFFTOptions | showMinMax;
   if (hasWidget)
@@ -2849,6 +3271,7 @@ void JSON::ProjectModel::generateComboBoxModels()
   m_decoderOptions.append(tr("Plain Text (UTF8)"));
   m_decoderOptions.append(tr("Hexadecimal"));
   m_decoderOptions.append(tr("Base64"));
+  m_decoderOptions.append(tr("Binary (Uint8Array)"));
 
   // Initialize frame detection methods
   m_frameDetectionMethods.clear();
@@ -2857,10 +3280,75 @@ void JSON::ProjectModel::generateComboBoxModels()
   m_frameDetectionMethods.append(tr("Start Delimiter Only"));
   m_frameDetectionMethods.append(tr("Start + End Delimiter"));
   m_frameDetectionMethods.append(tr("No Delimiters"));
+  m_frameDetectionMethods.append(tr("Length-Prefixed (Binary)"));
+  m_frameDetectionMethods.append(tr("COBS (Binary)"));
+  m_frameDetectionMethods.append(tr("SLIP (Binary)"));
   m_frameDetectionMethodsValues.append(SerialStudio::EndDelimiterOnly);
   m_frameDetectionMethodsValues.append(SerialStudio::StartDelimiterOnly);
   m_frameDetectionMethodsValues.append(SerialStudio::StartAndEndDelimiter);
   m_frameDetectionMethodsValues.append(SerialStudio::NoDelimiters);
+  m_frameDetectionMethodsValues.append(SerialStudio::LengthPrefixed);
+  m_frameDetectionMethodsValues.append(SerialStudio::COBS);
+  m_frameDetectionMethodsValues.append(SerialStudio::SLIP);
+
+  // Initialize length field sizes
+  m_lengthSizes.clear();
+  m_lengthSizesValues.clear();
+  m_lengthSizes.append(tr("1 Byte"));
+  m_lengthSizes.append(tr("2 Bytes"));
+  m_lengthSizes.append(tr("4 Bytes"));
+  m_lengthSizesValues.append(1);
+  m_lengthSizesValues.append(2);
+  m_lengthSizesValues.append(4);
+
+  // Initialize byte orders
+  m_byteOrders.clear();
+  m_byteOrders.append(tr("Big Endian"));
+  m_byteOrders.append(tr("Little Endian"));
+
+  // Initialize frame parser methods
+  m_parserMethods.clear();
+  m_parserMethods.append(tr("JavaScript Function"));
+  m_parserMethods.append(tr("Native Separator"));
+  m_parserMethods.append(tr("Binary Structure"));
+
+  // Initialize binary field types
+  m_binaryTypes.clear();
+  m_binaryTypes.append(tr("Unsigned 8-bit"));
+  m_binaryTypes.append(tr("Unsigned 16-bit"));
+  m_binaryTypes.append(tr("Unsigned 32-bit"));
+  m_binaryTypes.append(tr("Unsigned 64-bit"));
+  m_binaryTypes.append(tr("Signed 8-bit"));
+  m_binaryTypes.append(tr("Signed 16-bit"));
+  m_binaryTypes.append(tr("Signed 32-bit"));
+  m_binaryTypes.append(tr("Signed 64-bit"));
+  m_binaryTypes.append(tr("Float (32-bit)"));
+  m_binaryTypes.append(tr("Double (64-bit)"));
+  m_binaryTypes.append(tr("Bitfield"));
+
+  // Initialize checksum algorithms
+  m_checksumMethods.clear();
+  m_checksumMethodsValues.clear();
+  m_checksumMethods.append(tr("Auto-Detect"));
+  m_checksumMethods.append(tr("None"));
+  m_checksumMethods.append(tr("CRC-8"));
+  m_checksumMethods.append(tr("CRC-16/CCITT-FALSE"));
+  m_checksumMethods.append(tr("CRC-16/MODBUS"));
+  m_checksumMethods.append(tr("CRC-32"));
+  m_checksumMethods.append(tr("CRC-32C"));
+  m_checksumMethods.append(tr("Fletcher-16"));
+  m_checksumMethods.append(tr("XOR-8"));
+  m_checksumMethods.append(tr("Sum-8"));
+  m_checksumMethodsValues.append(SerialStudio::AutoDetectChecksum);
+  m_checksumMethodsValues.append(SerialStudio::NoChecksum);
+  m_checksumMethodsValues.append(SerialStudio::CRC8);
+  m_checksumMethodsValues.append(SerialStudio::CRC16);
+  m_checksumMethodsValues.append(SerialStudio::CRC16Modbus);
+  m_checksumMethodsValues.append(SerialStudio::CRC32);
+  m_checksumMethodsValues.append(SerialStudio::CRC32C);
+  m_checksumMethodsValues.append(SerialStudio::Fletcher16);
+  m_checksumMethodsValues.append(SerialStudio::XOR8);
+  m_checksumMethodsValues.append(SerialStudio::Sum8);
 
   // Initialize group-level widgets
   m_groupWidgets.clear();
@@ -3002,6 +3490,15 @@ void JSON::ProjectModel::onGroupItemChanged(QStandardItem *item)
     m_groups.replace(groupId, m_selectedGroup);
   }
 
+  // Change group data source
+  else if (id == kGroupView_Source)
+  {
+    const auto source = qBound(0, value.toInt(), m_sources.count());
+    modified = m_selectedGroup.m_sourceId != source;
+    m_selectedGroup.m_sourceId = source;
+    m_groups.replace(groupId, m_selectedGroup);
+  }
+
   // Change group widget
   else if (id == kGroupView_Widget)
   {
@@ -3161,6 +3658,46 @@ void JSON::ProjectModel::onProjectItemChanged(QStandardItem *item)
       Q_EMIT frameDetectionChanged();
       buildProjectModel();
       break;
+    case kProjectView_Checksum:
+      m_checksumAlgorithm = m_checksumMethodsValues.at(value.toInt());
+      Q_EMIT checksumAlgorithmChanged();
+      break;
+    case kProjectView_SyncWord:
+      m_syncWord = value.toString();
+      Q_EMIT lengthPrefixFormatChanged();
+      break;
+    case kProjectView_LengthOffset:
+      m_lengthOffset = qMax(0, value.toInt());
+      Q_EMIT lengthPrefixFormatChanged();
+      break;
+    case kProjectView_LengthSize:
+      m_lengthSize = m_lengthSizesValues.at(value.toInt());
+      Q_EMIT lengthPrefixFormatChanged();
+      break;
+    case kProjectView_ByteOrder:
+      m_lengthBigEndian = value.toInt() == 0;
+      Q_EMIT lengthPrefixFormatChanged();
+      break;
+    case kProjectView_MaxFrameLength:
+      m_maxFrameLength = qMax(0, value.toInt());
+      Q_EMIT lengthPrefixFormatChanged();
+      break;
+    case kProjectView_ParserMethod:
+      m_parserMethod = static_cast<SerialStudio::ParserMethod>(value.toInt());
+      buildProjectModel();
+      break;
+    case kProjectView_FieldSeparator:
+      m_fieldSeparator = value.toString();
+      break;
+    case kProjectView_QuoteCharacter:
+      m_quoteCharacter = value.toString().left(1);
+      break;
+    case kProjectView_TrimFields:
+      m_trimFields = value.toBool();
+      break;
+    case kProjectView_ParallelParsing:
+      m_parallelParsing = value.toBool();
+      break;
     case kProjectView_ThunderforestApiKey:
       m_thunderforestApiKey = value.toString();
       Q_EMIT gpsApiKeysChanged();
@@ -3266,6 +3803,33 @@ void JSON::ProjectModel::onDatasetItemChanged(QStandardItem *item)
     case kDatasetView_FFT_SamplingRate:
       m_selectedDataset.m_fftSamplingRate = value.toInt();
       break;
+    case kDatasetView_BinaryType:
+      m_selectedDataset.m_binaryField.type
+          = static_cast<JSON::BinaryField::Type>(value.toInt());
+      buildDatasetModel(m_selectedDataset);
+      break;
+    case kDatasetView_BinaryOffset:
+      m_selectedDataset.m_binaryField.byteOffset = qMax(0, value.toInt());
+      break;
+    case kDatasetView_BinaryByteOrder:
+      m_selectedDataset.m_binaryField.bigEndian = (value.toInt() == 0);
+      break;
+    case kDatasetView_BinaryBitOffset:
+      m_selectedDataset.m_binaryField.bitOffset = qBound(0, value.toInt(), 63);
+      m_selectedDataset.m_binaryField.bitWidth
+          = qMin(m_selectedDataset.m_binaryField.bitWidth,
+                 64 - m_selectedDataset.m_binaryField.bitOffset);
+      break;
+    case kDatasetView_BinaryBitWidth:
+      m_selectedDataset.m_binaryField.bitWidth = qBound(
+          1, value.toInt(), 64 - m_selectedDataset.m_binaryField.bitOffset);
+      break;
+    case kDatasetView_BinaryScale:
+      m_selectedDataset.m_binaryField.scale = value.toDouble();
+      break;
+    case kDatasetView_BinaryValueOffset:
+      m_selectedDataset.m_binaryField.offset = value.toDouble();
+      break;
     default:
       break;
   }
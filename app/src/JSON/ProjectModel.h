@@ -22,10 +22,13 @@
 #pragma once
 
 #include <QObject>
+#include <QJsonArray>
 #include <QStandardItemModel>
 #include <QItemSelectionModel>
 
 #include "SerialStudio.h"
+#include "IO/FrameReader.h"
+#include "JSON/FieldSplitter.h"
 
 #include "JSON/Group.h"
 #include "JSON/Action.h"
@@ -151,6 +154,8 @@ signals:
   void datasetOptionsChanged();
   void frameDetectionChanged();
   void editableOptionsChanged();
+  void checksumAlgorithmChanged();
+  void lengthPrefixFormatChanged();
   void frameParserCodeChanged();
 
 private:
@@ -220,6 +225,11 @@ public:
   [[nodiscard]] CurrentView currentView() const;
   [[nodiscard]] SerialStudio::DecoderMethod decoderMethod() const;
   [[nodiscard]] SerialStudio::FrameDetection frameDetection() const;
+  [[nodiscard]] SerialStudio::ChecksumAlgorithm checksumAlgorithm() const;
+  [[nodiscard]] IO::LengthPrefixFormat lengthPrefixFormat() const;
+  [[nodiscard]] SerialStudio::ParserMethod parserMethod() const;
+  [[nodiscard]] bool parallelParsing() const;
+  [[nodiscard]] JSON::FieldSplitterFormat fieldSplitterFormat() const;
 
   [[nodiscard]] QString jsonFileName() const;
   [[nodiscard]] QString jsonProjectsPath() const;
@@ -320,12 +330,27 @@ private:
   QString m_frameEndSequence;
   QString m_frameStartSequence;
 
+  QString m_syncWord;
+  int m_lengthOffset;
+  int m_lengthSize;
+  bool m_lengthBigEndian;
+  int m_maxFrameLength;
+
+  QString m_fieldSeparator;
+  QString m_quoteCharacter;
+  bool m_trimFields;
+  bool m_parallelParsing;
+
   QString m_mapTilerApiKey;
   QString m_thunderforestApiKey;
 
+  QJsonArray m_sources;
+
   CurrentView m_currentView;
   SerialStudio::DecoderMethod m_frameDecoder;
   SerialStudio::FrameDetection m_frameDetection;
+  SerialStudio::ChecksumAlgorithm m_checksumAlgorithm;
+  SerialStudio::ParserMethod m_parserMethod;
 
   bool m_modified;
   QString m_filePath;
@@ -350,6 +375,13 @@ private:
   QStringList m_decoderOptions;
   QStringList m_frameDetectionMethods;
   QList<SerialStudio::FrameDetection> m_frameDetectionMethodsValues;
+  QStringList m_checksumMethods;
+  QList<SerialStudio::ChecksumAlgorithm> m_checksumMethodsValues;
+  QStringList m_lengthSizes;
+  QList<int> m_lengthSizesValues;
+  QStringList m_byteOrders;
+  QStringList m_parserMethods;
+  QStringList m_binaryTypes;
 
   QMap<QString, QString> m_eolSequences;
   QMap<QString, QString> m_groupWidgets;
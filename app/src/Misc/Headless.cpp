@@ -0,0 +1,367 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "Misc/Headless.h"
+
+#include <QCoreApplication>
+
+#include <atomic>
+#include <csignal>
+#include <cstring>
+
+#include "CSV/Export.h"
+#include "IO/Manager.h"
+#include "IO/CaptureExport.h"
+#include "IO/Drivers/UART.h"
+#include "IO/Drivers/Replay.h"
+#include "IO/Drivers/Network.h"
+#include "JSON/ProjectModel.h"
+#include "JSON/FrameBuilder.h"
+#include "Misc/TimerEvents.h"
+#include "Misc/LatencyMonitor.h"
+#include "Misc/ThreadScheduler.h"
+#include "Plugins/Server.h"
+
+#ifdef USE_QT_COMMERCIAL
+#  include "MQTT/Client.h"
+#endif
+
+namespace
+{
+/**
+ * @brief Set by the signal handler when the user asks the application to quit.
+ */
+std::atomic<bool> QUIT_REQUESTED(false);
+
+/**
+ * @brief Handles SIGINT & SIGTERM, the flag is polled by the event loop, since
+ *        Qt functions are not async-signal-safe.
+ */
+void onQuitSignal(int)
+{
+  QUIT_REQUESTED = true;
+}
+
+/**
+ * @brief Splits a `host:port` string into its components.
+ *
+ * @return @c true if the port is a valid, non-zero number.
+ */
+bool splitHostPort(const QString &value, QString &host, quint16 &port)
+{
+  const auto separator = value.lastIndexOf(':');
+  if (separator <= 0)
+    return false;
+
+  bool ok = false;
+  host = value.left(separator);
+  port = value.mid(separator + 1).toUShort(&ok);
+  return ok && port > 0;
+}
+} // namespace
+
+/**
+ * Constructor function, quits the application when SIGINT or SIGTERM are
+ * received, so that the output files are closed properly.
+ */
+Misc::Headless::Headless()
+{
+  std::signal(SIGINT, onQuitSignal);
+  std::signal(SIGTERM, onQuitSignal);
+
+  connect(&Misc::TimerEvents::instance(), &Misc::TimerEvents::timeout10Hz,
+          this, [=] {
+            if (QUIT_REQUESTED)
+              QCoreApplication::quit();
+          });
+}
+
+/**
+ * Returns @c true if the application was launched with the `--headless`
+ * command line option.
+ */
+bool Misc::Headless::requested(int argc, char **argv)
+{
+  for (int i = 1; i < argc; ++i)
+  {
+    if (std::strcmp(argv[i], "--headless") == 0)
+      return true;
+  }
+
+  return false;
+}
+
+/**
+ * @brief Runs the data pipeline without user interface until the user quits
+ *        the application.
+ *
+ * @param argc argument count
+ * @param argv argument data
+ *
+ * @return Application exit code
+ */
+int Misc::Headless::exec(int &argc, char **argv)
+{
+  // Initialize application without GUI
+  QCoreApplication app(argc, argv);
+
+  // Read arguments
+  QCommandLineParser parser;
+  addOptions(parser);
+  parser.process(app);
+
+  // Create & start the data pipeline
+  Headless headless;
+  connect(&app, &QCoreApplication::aboutToQuit, &headless,
+          &Misc::Headless::onQuit);
+  if (!headless.start(parser))
+  {
+    headless.onQuit();
+    return EXIT_FAILURE;
+  }
+
+  // Enter application event loop
+  return app.exec();
+}
+
+/**
+ * @brief Creates the modules of the data pipeline, loads the project file and
+ *        connects to the device given in the command line.
+ *
+ * @return @c false if the project file or the device cannot be opened.
+ */
+bool Misc::Headless::start(const QCommandLineParser &parser)
+{
+  // Initialize modules, the project model is created before the frame reader
+  // threads, which read its frame detection settings
+  auto &csvExport = CSV::Export::instance();
+  auto &ioManager = IO::Manager::instance();
+  auto &projectModel = JSON::ProjectModel::instance();
+  auto &frameBuilder = JSON::FrameBuilder::instance();
+  auto &captureExport = IO::CaptureExport::instance();
+  auto &latencyMonitor = Misc::LatencyMonitor::instance();
+#ifdef USE_QT_COMMERCIAL
+  (void)MQTT::Client::instance();
+#endif
+
+  // Apply the CPU affinity of the main thread
+  Misc::ThreadScheduler::instance().registerCurrentThread(
+      QStringLiteral("Main"), Misc::ThreadScheduler::Main);
+
+  // Setup module interconnections
+  csvExport.setupExternalConnections();
+  ioManager.setupExternalConnections();
+  projectModel.setupExternalConnections();
+  frameBuilder.setupExternalConnections();
+  captureExport.setupExternalConnections();
+  latencyMonitor.setupExternalConnections();
+
+  // Load the project file
+  if (parser.isSet(QStringLiteral("project")))
+  {
+    frameBuilder.setOperationMode(SerialStudio::ProjectFile);
+    frameBuilder.loadJsonMap(parser.value(QStringLiteral("project")));
+    if (frameBuilder.jsonMapFilepath().isEmpty())
+      return false;
+  }
+
+  // Without project, plot comma-separated values
+  else
+    frameBuilder.setOperationMode(SerialStudio::QuickPlot);
+
+  // Configure exporters
+  csvExport.setExportEnabled(parser.isSet(QStringLiteral("csv")));
+  captureExport.setExportEnabled(parser.isSet(QStringLiteral("capture")));
+  if (parser.isSet(QStringLiteral("plugins")))
+    Plugins::Server::instance().setEnabled(true);
+
+  // Configure & open the device
+  if (!configureDriver(parser))
+    return false;
+
+  Misc::TimerEvents::instance().startTimers();
+  ioManager.connectDevice();
+
+  // TCP sockets connect asynchronously, the rest must be open by now
+  const bool tcp = parser.isSet(QStringLiteral("tcp"));
+  if (!tcp && !ioManager.isConnected())
+  {
+    qCritical() << "Unable to open the device";
+    return false;
+  }
+
+  return true;
+}
+
+/**
+ * Closes the output files & the device before quitting the application.
+ */
+void Misc::Headless::onQuit()
+{
+  Misc::TimerEvents::instance().stopTimers();
+
+  CSV::Export::instance().closeFile();
+  IO::CaptureExport::instance().closeFile();
+  IO::Manager::instance().disconnectDevice();
+  if (Plugins::Server::instance().enabled())
+    Plugins::Server::instance().removeConnection();
+}
+
+/**
+ * @brief Quits the application once the capture given with `--replay` has
+ *        been replayed and all of its frames went through the pipeline.
+ *
+ * The capture is done when the driver reached its end, the frame readers
+ * extracted all of the emitted data and had their frames collected, and the
+ * parser workers delivered every frame. Built frames reach the CSV exporter
+ * through queued connections, so the quit request is queued behind them, the
+ * output files are then closed by `onQuit()`.
+ */
+void Misc::Headless::quitIfReplayFinished()
+{
+  // Capture still being replayed, or data not yet split into frames
+  const auto &replay = IO::Drivers::Replay::instance();
+  if (!replay.finished() || replay.pendingBytes() > 0)
+    return;
+
+  // Frames still waiting in the frame readers or in the parser workers
+  if (IO::Manager::instance().statistics().queuedFrames > 0)
+    return;
+  if (JSON::FrameBuilder::instance().pendingFrames() > 0)
+    return;
+
+  // Let the exporters receive the last frames, then quit
+  disconnect(&Misc::TimerEvents::instance(), &Misc::TimerEvents::timeout10Hz,
+             this, &Misc::Headless::quitIfReplayFinished);
+  QMetaObject::invokeMethod(
+      qApp, [] { QCoreApplication::quit(); }, Qt::QueuedConnection);
+}
+
+/**
+ * Registers the command line options of the headless mode.
+ */
+void Misc::Headless::addOptions(QCommandLineParser &parser)
+{
+  // clang-format off
+  parser.setApplicationDescription(QStringLiteral("Runs the data pipeline without user interface."));
+  parser.addHelpOption();
+  parser.addVersionOption();
+  parser.addOptions({
+    {QStringLiteral("headless"), QStringLiteral("Run without user interface.")},
+    {QStringLiteral("project"), QStringLiteral("Project file used to parse frames, comma-separated values are plotted if omitted."), QStringLiteral("file")},
+    {QStringLiteral("uart"), QStringLiteral("Read from the given serial port."), QStringLiteral("port")},
+    {QStringLiteral("baud"), QStringLiteral("Baud rate of the serial port (default: 9600)."), QStringLiteral("rate"), QStringLiteral("9600")},
+    {QStringLiteral("tcp"), QStringLiteral("Connect to the given TCP server."), QStringLiteral("host:port")},
+    {QStringLiteral("udp"), QStringLiteral("Receive UDP datagrams on the given local port."), QStringLiteral("port")},
+    {QStringLiteral("udp-remote"), QStringLiteral("Remote host of the UDP socket."), QStringLiteral("host:port")},
+    {QStringLiteral("replay"), QStringLiteral("Replay the given raw data capture, and quit when it ends."), QStringLiteral("file")},
+    {QStringLiteral("speed"), QStringLiteral("Speed multiplier of the replay (default: 1)."), QStringLiteral("factor"), QStringLiteral("1")},
+    {QStringLiteral("as-fast-as-possible"), QStringLiteral("Replay the capture without waiting between records.")},
+    {QStringLiteral("csv"), QStringLiteral("Write the parsed values to CSV files.")},
+    {QStringLiteral("capture"), QStringLiteral("Record the raw data of the device.")},
+    {QStringLiteral("plugins"), QStringLiteral("Enable the plugin TCP server.")},
+  });
+  // clang-format on
+}
+
+/**
+ * @brief Configures the driver selected in the command line and selects its
+ *        bus type.
+ *
+ * @return @c false if no device was given, or if its settings are invalid.
+ */
+bool Misc::Headless::configureDriver(const QCommandLineParser &parser)
+{
+  auto &manager = IO::Manager::instance();
+
+  // Serial port
+  if (parser.isSet(QStringLiteral("uart")))
+  {
+    auto &uart = IO::Drivers::UART::instance();
+    uart.setBaudRate(parser.value(QStringLiteral("baud")).toInt());
+    uart.setPortName(parser.value(QStringLiteral("uart")));
+    manager.setBusType(SerialStudio::BusType::UART);
+    return true;
+  }
+
+  // TCP socket
+  if (parser.isSet(QStringLiteral("tcp")))
+  {
+    QString host;
+    quint16 port;
+    if (!splitHostPort(parser.value(QStringLiteral("tcp")), host, port))
+    {
+      qCritical() << "Invalid TCP server address";
+      return false;
+    }
+
+    auto &network = IO::Drivers::Network::instance();
+    network.setSocketType(QAbstractSocket::TcpSocket);
+    network.setRemoteAddress(host);
+    network.setTcpPort(port);
+    manager.setBusType(SerialStudio::BusType::Network);
+    return true;
+  }
+
+  // UDP socket
+  if (parser.isSet(QStringLiteral("udp")))
+  {
+    auto &network = IO::Drivers::Network::instance();
+    network.setSocketType(QAbstractSocket::UdpSocket);
+    network.setUdpLocalPort(parser.value(QStringLiteral("udp")).toUShort());
+    if (parser.isSet(QStringLiteral("udp-remote")))
+    {
+      QString host;
+      quint16 port;
+      const auto remote = parser.value(QStringLiteral("udp-remote"));
+      if (!splitHostPort(remote, host, port))
+      {
+        qCritical() << "Invalid UDP remote address";
+        return false;
+      }
+
+      network.setRemoteAddress(host);
+      network.setUdpRemotePort(port);
+    }
+
+    manager.setBusType(SerialStudio::BusType::Network);
+    return true;
+  }
+
+  // Raw data capture, quit once the last frames have been processed
+  if (parser.isSet(QStringLiteral("replay")))
+  {
+    auto &replay = IO::Drivers::Replay::instance();
+    replay.setFilePath(parser.value(QStringLiteral("replay")));
+    replay.setSpeed(parser.value(QStringLiteral("speed")).toDouble());
+    replay.setAsFastAsPossible(
+        parser.isSet(QStringLiteral("as-fast-as-possible")));
+    manager.setBusType(SerialStudio::BusType::Replay);
+
+    connect(&Misc::TimerEvents::instance(), &Misc::TimerEvents::timeout10Hz,
+            this, &Misc::Headless::quitIfReplayFinished);
+
+    return true;
+  }
+
+  qCritical() << "No device given, use --uart, --tcp, --udp or --replay";
+  return false;
+}
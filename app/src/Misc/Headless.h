@@ -0,0 +1,66 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <QObject>
+#include <QCommandLineParser>
+
+namespace Misc
+{
+/**
+ * @brief The Headless class
+ *
+ * Runs the data pipeline of Serial Studio without user interface, for logging
+ * machines and servers that have no display.
+ *
+ * Only the modules that read, frame, parse and export data are created: the
+ * device driver, `IO::Manager`, `JSON::FrameBuilder`, the CSV & raw data
+ * exporters, the plugin server and (in commercial builds) the MQTT client.
+ * No QML engine, dashboard or widget is instantiated, and the application
+ * runs on a `QCoreApplication`.
+ *
+ * The device, project file & exporters are configured from the command line,
+ * see `--headless --help` for the list of options.
+ */
+class Headless : public QObject
+{
+  Q_OBJECT
+
+public:
+  Headless();
+
+  static bool requested(int argc, char **argv);
+  static int exec(int &argc, char **argv);
+
+  [[nodiscard]] bool start(const QCommandLineParser &parser);
+
+public slots:
+  void onQuit();
+
+private slots:
+  void quitIfReplayFinished();
+
+private:
+  static void addOptions(QCommandLineParser &parser);
+  bool configureDriver(const QCommandLineParser &parser);
+};
+} // namespace Misc
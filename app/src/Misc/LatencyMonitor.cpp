@@ -0,0 +1,321 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "Misc/LatencyMonitor.h"
+
+#include <QQuickWindow>
+#include <QCoreApplication>
+
+#include "IO/Manager.h"
+#include "IO/FrameBatch.h"
+#include "Misc/TimerEvents.h"
+
+namespace
+{
+/**
+ * @brief Upper bounds (in nanoseconds) of the histogram buckets, following a
+ *        1-2-5 sequence. The last bucket counts everything above one second.
+ */
+constexpr qint64 BUCKET_LIMITS[]
+    = {100000LL,    200000LL,    500000LL,    1000000LL,    2000000LL,
+       5000000LL,   10000000LL,  20000000LL,  50000000LL,   100000000LL,
+       200000000LL, 500000000LL, 1000000000LL};
+
+/**
+ * @brief Maximum number of frames waiting for the next frame of the user
+ *        interface, so that a hidden window does not grow the list forever.
+ */
+constexpr qsizetype MAX_PENDING_RENDER = 4096;
+
+/**
+ * @brief Returns the index of the histogram bucket for the given @a latency.
+ */
+int bucketIndex(const qint64 latency)
+{
+  int i = 0;
+  for (const auto limit : BUCKET_LIMITS)
+  {
+    if (latency <= limit)
+      return i;
+
+    ++i;
+  }
+
+  return i;
+}
+
+/**
+ * @brief Converts the given nanoseconds to milliseconds.
+ */
+constexpr double toMs(const qint64 ns)
+{
+  return static_cast<double>(ns) / 1e6;
+}
+} // namespace
+
+/**
+ * Constructor function, the statistics are always updated from the main
+ * thread, even if the first frame was recorded by a worker thread.
+ */
+Misc::LatencyMonitor::LatencyMonitor()
+  : m_window(0)
+{
+  static_assert(std::size(BUCKET_LIMITS) + 1 == kBucketCount,
+                "Bucket limits do not match the bucket count");
+
+  if (qApp && thread() != qApp->thread())
+    moveToThread(qApp->thread());
+
+  reset();
+}
+
+/**
+ * Returns the only instance of the class.
+ */
+Misc::LatencyMonitor &Misc::LatencyMonitor::instance()
+{
+  static LatencyMonitor singleton;
+  return singleton;
+}
+
+/**
+ * Returns the rolling statistics of every stage of the pipeline, each item
+ * is a map with the name of the stage, the number of frames measured during
+ * the last ten seconds, the mean, median, 90th & 99th percentile and maximum
+ * latency (in milliseconds) and the fraction of frames in each histogram
+ * bucket.
+ *
+ * Percentiles are reported as the upper bound of the bucket that contains
+ * them.
+ */
+QVariantList Misc::LatencyMonitor::stages() const
+{
+  return m_stages;
+}
+
+/**
+ * Returns the labels of the histogram buckets, in the same order as the
+ * histograms returned by @c stages().
+ */
+QStringList Misc::LatencyMonitor::bucketLabels() const
+{
+  QStringList labels;
+  for (const auto limit : BUCKET_LIMITS)
+  {
+    if (limit < 1000000000LL)
+      labels.append(tr("%1 ms").arg(toMs(limit)));
+    else
+      labels.append(tr("%1 s").arg(limit / 1000000000LL));
+  }
+
+  labels.append(tr("> 1 s"));
+  return labels;
+}
+
+/**
+ * Records the latency of the frames with the given ingress @a timestamps for
+ * the given pipeline @a stage. May be called from any thread.
+ */
+void Misc::LatencyMonitor::record(const Stage stage,
+                                  const QVector<qint64> &timestamps)
+{
+  // Nothing to record
+  if (timestamps.isEmpty())
+    return;
+
+  // Obtain the histogram of the current second
+  const auto now = IO::monotonicTimestamp();
+  const auto window = m_window.load(std::memory_order_relaxed);
+  auto &histogram = m_history[window][stage];
+
+  // Count each frame in its bucket
+  qint64 sum = 0;
+  qint64 max = 0;
+  for (const auto timestamp : timestamps)
+  {
+    const auto latency = qMax<qint64>(0, now - timestamp);
+    histogram.buckets[bucketIndex(latency)].fetch_add(
+        1, std::memory_order_relaxed);
+
+    sum += latency;
+    max = qMax(max, latency);
+  }
+
+  // Update the sum & the maximum latency
+  histogram.sum.fetch_add(sum, std::memory_order_relaxed);
+  auto current = histogram.max.load(std::memory_order_relaxed);
+  while (current < max
+         && !histogram.max.compare_exchange_weak(current, max,
+                                                 std::memory_order_relaxed))
+    ;
+}
+
+/**
+ * Records the render latency of the frames with the given ingress
+ * @a timestamps once the render window presents its next frame.
+ */
+void Misc::LatencyMonitor::recordOnNextRender(const QVector<qint64> &timestamps)
+{
+  QMutexLocker locker(&m_renderLock);
+  const auto available = MAX_PENDING_RENDER - m_pendingRender.size();
+  m_pendingRender.append(timestamps.constData(),
+                         qMin(available, timestamps.size()));
+}
+
+/**
+ * Discards all the measurements.
+ */
+void Misc::LatencyMonitor::reset()
+{
+  for (int i = 0; i < kHistoryLength; ++i)
+    clearWindow(i);
+
+  m_renderLock.lock();
+  m_pendingRender.clear();
+  m_renderLock.unlock();
+
+  updateStatistics();
+}
+
+/**
+ * Updates the statistics every second & starts a new measurement whenever a
+ * device is connected or disconnected.
+ */
+void Misc::LatencyMonitor::setupExternalConnections()
+{
+  connect(&Misc::TimerEvents::instance(), &Misc::TimerEvents::timeout1Hz,
+          this, &Misc::LatencyMonitor::updateStatistics);
+  connect(&IO::Manager::instance(), &IO::Manager::connectedChanged, this,
+          &Misc::LatencyMonitor::reset);
+}
+
+/**
+ * Measures the render latency with the frames presented by the given
+ * @a window, which must be a @c QQuickWindow.
+ */
+void Misc::LatencyMonitor::setRenderWindow(QObject *window)
+{
+  auto quickWindow = qobject_cast<QQuickWindow *>(window);
+  if (quickWindow)
+  {
+    connect(quickWindow, &QQuickWindow::frameSwapped, this,
+            &Misc::LatencyMonitor::onFrameSwapped, Qt::DirectConnection);
+  }
+}
+
+/**
+ * Starts measuring a new second, and calculates the statistics of each
+ * stage with the histograms of the last ten seconds.
+ */
+void Misc::LatencyMonitor::updateStatistics()
+{
+  // Move to the next second, discarding the measurements made ten seconds ago
+  const auto next = (m_window.load(std::memory_order_relaxed) + 1)
+                    % kHistoryLength;
+  clearWindow(next);
+  m_window.store(next, std::memory_order_relaxed);
+
+  // Calculate the statistics of each stage
+  const QStringList names = {tr("Framing"), tr("Parsing"), tr("Dashboard"),
+                             tr("Rendering")};
+  m_stages.clear();
+  for (int stage = 0; stage < kStageCount; ++stage)
+  {
+    // Merge the histograms of the last ten seconds
+    qint64 sum = 0;
+    qint64 max = 0;
+    quint64 count = 0;
+    std::array<quint64, kBucketCount> buckets{};
+    for (const auto &window : m_history)
+    {
+      const auto &histogram = window[stage];
+      sum += histogram.sum.load(std::memory_order_relaxed);
+      max = qMax(max, histogram.max.load(std::memory_order_relaxed));
+      for (int i = 0; i < kBucketCount; ++i)
+      {
+        const auto n = histogram.buckets[i].load(std::memory_order_relaxed);
+        buckets[i] += n;
+        count += n;
+      }
+    }
+
+    // Obtain the upper bound of the bucket that contains a percentile
+    auto percentile = [&](const double fraction) {
+      const auto target = static_cast<quint64>(fraction * count);
+      quint64 accumulated = 0;
+      for (int i = 0; i < kBucketCount - 1; ++i)
+      {
+        accumulated += buckets[i];
+        if (accumulated > target)
+          return qMin(toMs(BUCKET_LIMITS[i]), toMs(max));
+      }
+
+      return toMs(max);
+    };
+
+    // Normalize the histogram
+    QVariantList histogram;
+    for (const auto n : buckets)
+      histogram.append(count > 0 ? static_cast<double>(n) / count : 0.0);
+
+    // Register the statistics of the stage
+    QVariantMap map;
+    map.insert(QStringLiteral("name"), names[stage]);
+    map.insert(QStringLiteral("count"), count);
+    map.insert(QStringLiteral("mean"), count > 0 ? toMs(sum) / count : 0.0);
+    map.insert(QStringLiteral("p50"), count > 0 ? percentile(0.50) : 0.0);
+    map.insert(QStringLiteral("p90"), count > 0 ? percentile(0.90) : 0.0);
+    map.insert(QStringLiteral("p99"), count > 0 ? percentile(0.99) : 0.0);
+    map.insert(QStringLiteral("max"), toMs(max));
+    map.insert(QStringLiteral("histogram"), histogram);
+    m_stages.append(map);
+  }
+
+  Q_EMIT statisticsChanged();
+}
+
+/**
+ * Records the render latency of the frames that were waiting for the render
+ * window, called from the render thread of the window.
+ */
+void Misc::LatencyMonitor::onFrameSwapped()
+{
+  QVector<qint64> timestamps;
+  m_renderLock.lock();
+  timestamps.swap(m_pendingRender);
+  m_renderLock.unlock();
+
+  record(Rendering, timestamps);
+}
+
+/**
+ * Discards the measurements of the second with the given @a index.
+ */
+void Misc::LatencyMonitor::clearWindow(const int index)
+{
+  for (auto &histogram : m_history[index])
+  {
+    histogram.sum.store(0, std::memory_order_relaxed);
+    histogram.max.store(0, std::memory_order_relaxed);
+    for (auto &bucket : histogram.buckets)
+      bucket.store(0, std::memory_order_relaxed);
+  }
+}
@@ -0,0 +1,127 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <QMutex>
+#include <QObject>
+#include <QVector>
+#include <QVariant>
+
+#include <array>
+#include <atomic>
+
+namespace Misc
+{
+/**
+ * @brief The LatencyMonitor class
+ *
+ * Measures how long frames take to go through each stage of the data
+ * pipeline. Every frame carries the monotonic time at which the data that
+ * completed it was received (see `IO::monotonicTimestamp()`), and each stage
+ * records the time elapsed since then once it is done with the frame:
+ *
+ * - **Framing:** the frame reader extracted the frame from the byte stream.
+ * - **Parsing:** the frame builder parsed the frame.
+ * - **Dashboard:** the dashboard updated the data of its widgets.
+ * - **Rendering:** the main window presented the first frame drawn after the
+ *   dashboard notified its widgets.
+ *
+ * Latencies are counted in fixed histogram buckets with relaxed atomics, so
+ * that any thread can record them without locking. A histogram is kept for
+ * each of the last ten seconds, and the rolling statistics shown by the
+ * diagnostics dialog are updated once per second.
+ */
+class LatencyMonitor : public QObject
+{
+  // clang-format off
+  Q_OBJECT
+  Q_PROPERTY(QVariantList stages
+             READ stages
+             NOTIFY statisticsChanged)
+  Q_PROPERTY(QStringList bucketLabels
+             READ bucketLabels
+             CONSTANT)
+  // clang-format on
+
+signals:
+  void statisticsChanged();
+
+private:
+  explicit LatencyMonitor();
+  LatencyMonitor(LatencyMonitor &&) = delete;
+  LatencyMonitor(const LatencyMonitor &) = delete;
+  LatencyMonitor &operator=(LatencyMonitor &&) = delete;
+  LatencyMonitor &operator=(const LatencyMonitor &) = delete;
+
+public:
+  enum Stage
+  {
+    Framing,
+    Parsing,
+    Dashboard,
+    Rendering,
+  };
+  Q_ENUM(Stage)
+
+  static LatencyMonitor &instance();
+
+  [[nodiscard]] QVariantList stages() const;
+  [[nodiscard]] QStringList bucketLabels() const;
+
+  void record(const Stage stage, const QVector<qint64> &timestamps);
+  void recordOnNextRender(const QVector<qint64> &timestamps);
+
+public slots:
+  void reset();
+  void setupExternalConnections();
+  void setRenderWindow(QObject *window);
+
+private slots:
+  void updateStatistics();
+
+private:
+  void onFrameSwapped();
+  void clearWindow(const int index);
+
+private:
+  static constexpr int kStageCount = Rendering + 1;
+  static constexpr int kBucketCount = 14;
+  static constexpr int kHistoryLength = 10;
+
+  struct Histogram
+  {
+    std::atomic<qint64> sum{0};
+    std::atomic<qint64> max{0};
+    std::array<std::atomic<quint32>, kBucketCount> buckets{};
+  };
+
+  using Window = std::array<Histogram, kStageCount>;
+
+  std::atomic<int> m_window;
+  std::array<Window, kHistoryLength> m_history;
+
+  QMutex m_renderLock;
+  QVector<qint64> m_pendingRender;
+
+  QVariantList m_stages;
+};
+} // namespace Misc
@@ -38,10 +38,12 @@
 #include "IO/Manager.h"
 #include "IO/Console.h"
 #include "IO/ConsoleExport.h"
+#include "IO/CaptureExport.h"
 #include "IO/FileTransmission.h"
 
 #include "IO/Drivers/UART.h"
 #include "IO/Drivers/Network.h"
+#include "IO/Drivers/Replay.h"
 #include "IO/Drivers/BluetoothLE.h"
 
 #include "Misc/Utilities.h"
@@ -49,6 +51,8 @@
 #include "Misc/CommonFonts.h"
 #include "Misc/TimerEvents.h"
 #include "Misc/ThemeManager.h"
+#include "Misc/ThreadScheduler.h"
+#include "Misc/LatencyMonitor.h"
 #include "Misc/ModuleManager.h"
 
 #include "Plugins/Server.h"
@@ -277,13 +281,17 @@ void Misc::ModuleManager::initializeQmlInterface()
   auto pluginsBridge = &Plugins::Server::instance();
   auto miscUtilities = &Misc::Utilities::instance();
   auto ioNetwork = &IO::Drivers::Network::instance();
+  auto ioReplay = &IO::Drivers::Replay::instance();
   auto frameBuilder = &JSON::FrameBuilder::instance();
   auto miscTranslator = &Misc::Translator::instance();
   auto projectModel = &JSON::ProjectModel::instance();
   auto miscTimerEvents = &Misc::TimerEvents::instance();
   auto miscCommonFonts = &Misc::CommonFonts::instance();
   auto ioConsoleExport = &IO::ConsoleExport::instance();
+  auto ioCaptureExport = &IO::CaptureExport::instance();
   auto miscThemeManager = &Misc::ThemeManager::instance();
+  auto miscLatencyMonitor = &Misc::LatencyMonitor::instance();
+  auto miscThreadScheduler = &Misc::ThreadScheduler::instance();
   auto ioBluetoothLE = &IO::Drivers::BluetoothLE::instance();
   auto ioFileTransmission = &IO::FileTransmission::instance();
 
@@ -301,6 +309,10 @@ void Misc::ModuleManager::initializeQmlInterface()
   // Start common event timers
   miscTimerEvents->startTimers();
 
+  // Apply the CPU affinity of the user interface thread
+  miscThreadScheduler->registerCurrentThread(
+      tr("User Interface"), Misc::ThreadScheduler::Main);
+
   // Retranslate the QML interface automatically
   connect(miscTranslator, &Misc::Translator::languageChanged, &m_engine,
           &QQmlApplicationEngine::retranslate);
@@ -318,6 +330,7 @@ void Misc::ModuleManager::initializeQmlInterface()
   c->setContextProperty("Cpp_IO_Console", ioConsole);
   c->setContextProperty("Cpp_IO_Manager", ioManager);
   c->setContextProperty("Cpp_IO_Network", ioNetwork);
+  c->setContextProperty("Cpp_IO_Replay", ioReplay);
   c->setContextProperty("Cpp_UI_Dashboard", uiDashboard);
   c->setContextProperty("Cpp_NativeWindow", &m_nativeWindow);
   c->setContextProperty("Cpp_Plugins_Bridge", pluginsBridge);
@@ -329,7 +342,10 @@ void Misc::ModuleManager::initializeQmlInterface()
   c->setContextProperty("Cpp_JSON_FrameBuilder", frameBuilder);
   c->setContextProperty("Cpp_Misc_TimerEvents", miscTimerEvents);
   c->setContextProperty("Cpp_Misc_CommonFonts", miscCommonFonts);
+  c->setContextProperty("Cpp_Misc_LatencyMonitor", miscLatencyMonitor);
+  c->setContextProperty("Cpp_Misc_ThreadScheduler", miscThreadScheduler);
   c->setContextProperty("Cpp_IO_ConsoleExport", ioConsoleExport);
+  c->setContextProperty("Cpp_IO_CaptureExport", ioCaptureExport);
   c->setContextProperty("Cpp_IO_FileTransmission", ioFileTransmission);
   c->setContextProperty("Cpp_QtCommercial_Available", qtCommercialAvailable);
 
@@ -362,6 +378,8 @@ void Misc::ModuleManager::initializeQmlInterface()
   projectModel->setupExternalConnections();
   frameBuilder->setupExternalConnections();
   ioConsoleExport->setupExternalConnections();
+  ioCaptureExport->setupExternalConnections();
+  miscLatencyMonitor->setupExternalConnections();
 
   // Install custom message handler to redirect qDebug output to console
   qInstallMessageHandler(MessageHandler);
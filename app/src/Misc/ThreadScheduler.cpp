@@ -0,0 +1,440 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "Misc/ThreadScheduler.h"
+
+#include <cstring>
+
+#ifdef Q_OS_LINUX
+#  include <cerrno>
+#  include <sched.h>
+#  include <pthread.h>
+#endif
+
+namespace
+{
+/**
+ * @brief Highest CPU index (exclusive) accepted in a CPU list.
+ */
+#ifdef Q_OS_LINUX
+constexpr int kMaxCpus = CPU_SETSIZE;
+#else
+constexpr int kMaxCpus = 1024;
+#endif
+
+/**
+ * @brief Parses a list of CPUs such as `0,2-3`.
+ *
+ * CPU indexes must be lower than @c kMaxCpus. On failure @a cpus is cleared,
+ * so that the caller falls back to its default affinity instead of using a
+ * partially parsed list.
+ *
+ * @return @c false if the list is malformed, an empty list is valid and means
+ *         that the thread may run on any CPU.
+ */
+bool parseCpuList(const QString &list, QVector<int> &cpus)
+{
+  cpus.clear();
+  const auto items = list.split(',', Qt::SkipEmptyParts);
+  for (const auto &item : items)
+  {
+    bool ok = false;
+    const auto range = item.trimmed().split('-');
+    const auto first = range.first().trimmed().toInt(&ok);
+    if (!ok || first < 0 || first >= kMaxCpus || range.count() > 2)
+    {
+      cpus.clear();
+      return false;
+    }
+
+    auto last = first;
+    if (range.count() == 2)
+    {
+      last = range.last().trimmed().toInt(&ok);
+      if (!ok || last < first || last >= kMaxCpus)
+      {
+        cpus.clear();
+        return false;
+      }
+    }
+
+    for (int cpu = first; cpu <= last; ++cpu)
+      cpus.append(cpu);
+  }
+
+  return true;
+}
+
+/**
+ * @brief Formats a sorted list of CPUs with ranges, e.g. `0,2-3`.
+ */
+QString formatCpuList(const QVector<int> &cpus)
+{
+  QStringList items;
+  for (int i = 0; i < cpus.count(); ++i)
+  {
+    const auto first = cpus.at(i);
+    while (i + 1 < cpus.count() && cpus.at(i + 1) == cpus.at(i) + 1)
+      ++i;
+
+    if (cpus.at(i) == first)
+      items.append(QString::number(first));
+    else
+      items.append(QStringLiteral("%1-%2").arg(first).arg(cpus.at(i)));
+  }
+
+  return items.join(',');
+}
+} // namespace
+
+/**
+ * Constructor function, reads the settings & the CPUs that the process may
+ * use, which are restored when a CPU list is cleared.
+ */
+Misc::ThreadScheduler::ThreadScheduler()
+{
+  const auto policy = m_settings.value("ThreadSchedulingPolicy", 0).toInt();
+  m_policy = static_cast<Policy>(qBound(0, policy, 2));
+  m_priority = qBound(1, m_settings.value("RealtimePriority", 20).toInt(), 99);
+  m_mainCpus = m_settings.value("MainThreadCpus").toString();
+  m_ingestCpus = m_settings.value("IngestThreadCpus").toString();
+
+#ifdef Q_OS_LINUX
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  if (sched_getaffinity(0, sizeof(set), &set) == 0)
+  {
+    for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+    {
+      if (CPU_ISSET(cpu, &set))
+        m_defaultCpus.append(cpu);
+    }
+  }
+#endif
+}
+
+/**
+ * Returns the only instance of the class.
+ */
+Misc::ThreadScheduler &Misc::ThreadScheduler::instance()
+{
+  static ThreadScheduler singleton;
+  return singleton;
+}
+
+/**
+ * Returns @c true if thread affinity & real-time scheduling can be configured
+ * on this platform.
+ */
+bool Misc::ThreadScheduler::supported() const
+{
+#ifdef Q_OS_LINUX
+  return true;
+#else
+  return false;
+#endif
+}
+
+/**
+ * Returns the scheduling policy of the device I/O & frame reader threads, as
+ * an index of @c policies().
+ */
+int Misc::ThreadScheduler::policy() const
+{
+  QMutexLocker locker(&m_mutex);
+  return m_policy;
+}
+
+/**
+ * Returns the real-time priority (1-99) of the device I/O thread, frame
+ * reader threads run one level below it.
+ */
+int Misc::ThreadScheduler::priority() const
+{
+  QMutexLocker locker(&m_mutex);
+  return m_priority;
+}
+
+/**
+ * Returns the names of the available scheduling policies.
+ */
+QStringList Misc::ThreadScheduler::policies() const
+{
+  return {tr("Normal"), tr("Real-Time (FIFO)"), tr("Real-Time (Round Robin)")};
+}
+
+/**
+ * Returns the CPUs of the device I/O & frame reader threads, an empty list
+ * lets them run on any CPU.
+ */
+QString Misc::ThreadScheduler::ingestCpus() const
+{
+  QMutexLocker locker(&m_mutex);
+  return m_ingestCpus;
+}
+
+/**
+ * Returns the CPUs of the main (user interface) thread, an empty list lets it
+ * run on any CPU.
+ */
+QString Misc::ThreadScheduler::mainCpus() const
+{
+  QMutexLocker locker(&m_mutex);
+  return m_mainCpus;
+}
+
+/**
+ * Returns the name, scheduling policy, CPUs & configuration status of every
+ * registered thread that is running.
+ */
+QVariantList Misc::ThreadScheduler::threads() const
+{
+  QMutexLocker locker(&m_mutex);
+
+  QVariantList list;
+  for (const auto &info : m_threads)
+  {
+    QVariantMap map;
+    map.insert(QStringLiteral("name"), info.name);
+    map.insert(QStringLiteral("scheduling"), info.scheduling);
+    map.insert(QStringLiteral("cpus"), info.cpus);
+    map.insert(QStringLiteral("status"), info.status);
+    list.append(map);
+  }
+
+  return list;
+}
+
+/**
+ * Configures the given @a thread with the settings of its @a role as soon as
+ * it starts, must be called before starting the thread.
+ */
+void Misc::ThreadScheduler::registerThread(QThread *thread, const Role role)
+{
+  Q_ASSERT(thread);
+
+  const auto name = thread->objectName();
+  connect(
+      thread, &QThread::started, this,
+      [=] { registerCurrentThread(name, role); }, Qt::DirectConnection);
+  connect(
+      thread, &QThread::finished, this, [=] { unregisterCurrentThread(); },
+      Qt::DirectConnection);
+}
+
+/**
+ * Configures the calling thread with the settings of the given @a role, and
+ * lists it with the given @a name.
+ */
+void Misc::ThreadScheduler::registerCurrentThread(const QString &name,
+                                                  const Role role)
+{
+  ThreadInfo info;
+  info.name = name;
+  info.role = role;
+  info.handle = QThread::currentThreadId();
+
+  m_mutex.lock();
+  apply(info);
+  m_threads.append(info);
+  m_mutex.unlock();
+
+  QMetaObject::invokeMethod(
+      this, [=] { Q_EMIT threadsChanged(); }, Qt::QueuedConnection);
+}
+
+/**
+ * Changes the scheduling policy of the device I/O & frame reader threads.
+ */
+void Misc::ThreadScheduler::setPolicy(const int policy)
+{
+  m_mutex.lock();
+  m_policy = static_cast<Policy>(qBound(0, policy, 2));
+  m_mutex.unlock();
+
+  m_settings.setValue("ThreadSchedulingPolicy", this->policy());
+  applySettings();
+}
+
+/**
+ * Changes the real-time priority of the device I/O thread.
+ */
+void Misc::ThreadScheduler::setPriority(const int priority)
+{
+  m_mutex.lock();
+  m_priority = qBound(1, priority, 99);
+  m_mutex.unlock();
+
+  m_settings.setValue("RealtimePriority", this->priority());
+  applySettings();
+}
+
+/**
+ * Changes the CPUs of the device I/O & frame reader threads.
+ */
+void Misc::ThreadScheduler::setIngestCpus(const QString &cpus)
+{
+  m_mutex.lock();
+  m_ingestCpus = cpus.simplified();
+  m_mutex.unlock();
+
+  m_settings.setValue("IngestThreadCpus", cpus.simplified());
+  applySettings();
+}
+
+/**
+ * Changes the CPUs of the main thread.
+ */
+void Misc::ThreadScheduler::setMainCpus(const QString &cpus)
+{
+  m_mutex.lock();
+  m_mainCpus = cpus.simplified();
+  m_mutex.unlock();
+
+  m_settings.setValue("MainThreadCpus", cpus.simplified());
+  applySettings();
+}
+
+/**
+ * Applies the current settings to all registered threads.
+ */
+void Misc::ThreadScheduler::applySettings()
+{
+  m_mutex.lock();
+  for (auto &info : m_threads)
+    apply(info);
+  m_mutex.unlock();
+
+  Q_EMIT settingsChanged();
+  Q_EMIT threadsChanged();
+}
+
+/**
+ * Pins the thread described by @a info to the CPUs of its role & changes its
+ * scheduling policy, then reads back the resulting configuration.
+ *
+ * If the process is not allowed to use real-time scheduling, the thread keeps
+ * its current policy. Must be called with the mutex locked.
+ */
+void Misc::ThreadScheduler::apply(ThreadInfo &info)
+{
+#ifdef Q_OS_LINUX
+  QStringList errors;
+  const auto handle = reinterpret_cast<pthread_t>(info.handle);
+
+  // Obtain the CPUs of the thread, use all CPUs of the process by default
+  QVector<int> cpus;
+  const auto &list = info.role == Main ? m_mainCpus : m_ingestCpus;
+  if (!parseCpuList(list, cpus))
+    errors.append(tr("Invalid CPU list \"%1\"").arg(list));
+  if (cpus.isEmpty())
+    cpus = m_defaultCpus;
+
+  // Pin the thread to the CPUs
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  for (const auto cpu : std::as_const(cpus))
+  {
+    if (cpu < CPU_SETSIZE)
+      CPU_SET(cpu, &set);
+  }
+
+  auto rc = pthread_setaffinity_np(handle, sizeof(set), &set);
+  if (rc != 0)
+    errors.append(tr("Unable to set the CPU affinity: %1")
+                      .arg(QString::fromLocal8Bit(std::strerror(rc))));
+
+  // Select the policy, frame readers run one level below the device I/O
+  int policy = SCHED_OTHER;
+  sched_param param{};
+  if (info.role != Main && m_policy != Normal)
+  {
+    policy = m_policy == Fifo ? SCHED_FIFO : SCHED_RR;
+    const auto offset = info.role == Framing ? 1 : 0;
+    param.sched_priority = qBound(sched_get_priority_min(policy),
+                                  m_priority - offset,
+                                  sched_get_priority_max(policy));
+  }
+
+  // Change the policy, threads that never left the normal policy are not
+  // touched, so that they keep the priority assigned by Qt
+  int current = SCHED_OTHER;
+  sched_param currentParam{};
+  (void)pthread_getschedparam(handle, &current, &currentParam);
+  if (policy != SCHED_OTHER || current != SCHED_OTHER)
+  {
+    rc = pthread_setschedparam(handle, policy, &param);
+    if (rc == EPERM)
+      errors.append(tr("Real-time scheduling is not permitted, grant the "
+                       "CAP_SYS_NICE capability or raise RLIMIT_RTPRIO"));
+    else if (rc != 0)
+      errors.append(tr("Unable to set the scheduling policy: %1")
+                        .arg(QString::fromLocal8Bit(std::strerror(rc))));
+  }
+
+  // Read back the scheduling policy
+  info.scheduling = tr("Normal");
+  if (pthread_getschedparam(handle, &current, &currentParam) == 0)
+  {
+    const auto priority = currentParam.sched_priority;
+    if (current == SCHED_FIFO)
+      info.scheduling = tr("FIFO, priority %1").arg(priority);
+    else if (current == SCHED_RR)
+      info.scheduling = tr("RR, priority %1").arg(priority);
+  }
+
+  // Read back the CPU affinity
+  cpus.clear();
+  CPU_ZERO(&set);
+  if (pthread_getaffinity_np(handle, sizeof(set), &set) == 0)
+  {
+    for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+    {
+      if (CPU_ISSET(cpu, &set))
+        cpus.append(cpu);
+    }
+  }
+
+  info.cpus = formatCpuList(cpus);
+  info.status = errors.isEmpty() ? tr("OK") : errors.join(QStringLiteral("; "));
+#else
+  info.scheduling = tr("Default");
+  info.cpus = tr("Any");
+  info.status = tr("Not supported on this platform");
+#endif
+}
+
+/**
+ * Removes the calling thread from the list of registered threads.
+ */
+void Misc::ThreadScheduler::unregisterCurrentThread()
+{
+  const auto handle = QThread::currentThreadId();
+
+  m_mutex.lock();
+  m_threads.removeIf([=](const ThreadInfo &info) {
+    return info.handle == handle;
+  });
+  m_mutex.unlock();
+
+  QMetaObject::invokeMethod(
+      this, [=] { Q_EMIT threadsChanged(); }, Qt::QueuedConnection);
+}
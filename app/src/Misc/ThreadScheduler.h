@@ -0,0 +1,158 @@
+/*
+ * Serial Studio - https://serial-studio.github.io/
+ *
+ * Copyright (C) 2020-2025 Alex Spataru <https://aspatru.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <QMutex>
+#include <QObject>
+#include <QThread>
+#include <QVector>
+#include <QVariant>
+#include <QSettings>
+
+namespace Misc
+{
+/**
+ * @brief The ThreadScheduler class
+ *
+ * Configures the CPU affinity & scheduling policy of the threads that receive
+ * and frame device data, so that they are not delayed by the user interface,
+ * the compositor or other processes.
+ *
+ * - The device I/O & frame reader threads can run with a real-time policy
+ *   (@c SCHED_FIFO or @c SCHED_RR) and be pinned to a set of CPUs.
+ * - The main thread, which runs the user interface, can be pinned to another
+ *   set of CPUs.
+ *
+ * Threads are registered before they start and configure themselves once
+ * running; later changes to the settings are applied to all running threads.
+ * When the process lacks the privileges for real-time scheduling (e.g. no
+ * @c CAP_SYS_NICE capability or @c RLIMIT_RTPRIO limit), threads keep the
+ * normal scheduling policy and the error is reported in @c threads().
+ *
+ * Real-time scheduling & CPU affinity are only supported on Linux, other
+ * platforms keep the thread priorities set by Qt.
+ */
+class ThreadScheduler : public QObject
+{
+  // clang-format off
+  Q_OBJECT
+  Q_PROPERTY(bool supported
+             READ supported
+             CONSTANT)
+  Q_PROPERTY(int policy
+             READ policy
+             WRITE setPolicy
+             NOTIFY settingsChanged)
+  Q_PROPERTY(QStringList policies
+             READ policies
+             CONSTANT)
+  Q_PROPERTY(int priority
+             READ priority
+             WRITE setPriority
+             NOTIFY settingsChanged)
+  Q_PROPERTY(QString ingestCpus
+             READ ingestCpus
+             WRITE setIngestCpus
+             NOTIFY settingsChanged)
+  Q_PROPERTY(QString mainCpus
+             READ mainCpus
+             WRITE setMainCpus
+             NOTIFY settingsChanged)
+  Q_PROPERTY(QVariantList threads
+             READ threads
+             NOTIFY threadsChanged)
+  // clang-format on
+
+signals:
+  void threadsChanged();
+  void settingsChanged();
+
+private:
+  explicit ThreadScheduler();
+  ThreadScheduler(ThreadScheduler &&) = delete;
+  ThreadScheduler(const ThreadScheduler &) = delete;
+  ThreadScheduler &operator=(ThreadScheduler &&) = delete;
+  ThreadScheduler &operator=(const ThreadScheduler &) = delete;
+
+public:
+  enum Role
+  {
+    DeviceIO,
+    Framing,
+    Main,
+  };
+  Q_ENUM(Role)
+
+  enum Policy
+  {
+    Normal,
+    Fifo,
+    RoundRobin,
+  };
+  Q_ENUM(Policy)
+
+  static ThreadScheduler &instance();
+
+  [[nodiscard]] bool supported() const;
+  [[nodiscard]] int policy() const;
+  [[nodiscard]] int priority() const;
+  [[nodiscard]] QStringList policies() const;
+  [[nodiscard]] QString ingestCpus() const;
+  [[nodiscard]] QString mainCpus() const;
+  [[nodiscard]] QVariantList threads() const;
+
+  void registerThread(QThread *thread, const Role role);
+  void registerCurrentThread(const QString &name, const Role role);
+
+public slots:
+  void setPolicy(const int policy);
+  void setPriority(const int priority);
+  void setIngestCpus(const QString &cpus);
+  void setMainCpus(const QString &cpus);
+
+private:
+  struct ThreadInfo
+  {
+    QString name;
+    Role role;
+    Qt::HANDLE handle;
+    QString scheduling;
+    QString cpus;
+    QString status;
+  };
+
+  void applySettings();
+  void apply(ThreadInfo &info);
+  void unregisterCurrentThread();
+
+private:
+  mutable QMutex m_mutex;
+  QSettings m_settings;
+
+  Policy m_policy;
+  int m_priority;
+  QString m_mainCpus;
+  QString m_ingestCpus;
+  QVector<int> m_defaultCpus;
+  QVector<ThreadInfo> m_threads;
+};
+} // namespace Misc
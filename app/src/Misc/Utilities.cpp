@@ -123,13 +123,29 @@ QString Misc::Utilities::hdpiImagePath(const QString &path)
 }
 
 /**
- * Shows a macOS-like message box with the given properties
+ * Shows a macOS-like message box with the given properties.
+ *
+ * When running without user interface (see `Misc::Headless`), the message is
+ * printed to the log instead, and the default button is returned.
  */
 int Misc::Utilities::showMessageBox(
     const QString &text, const QString &informativeText, QMessageBox::Icon icon,
     const QString &windowTitle, QMessageBox::StandardButtons bt,
     QMessageBox::StandardButton defaultButton, const ButtonTextMap &buttonTexts)
 {
+  // No widgets can be created, log the message
+  if (!qobject_cast<QApplication *>(QCoreApplication::instance()))
+  {
+    if (icon == QMessageBox::Critical)
+      qCritical().noquote() << text << informativeText;
+    else
+      qWarning().noquote() << text << informativeText;
+
+    if (defaultButton != QMessageBox::NoButton)
+      return defaultButton;
+
+    return QMessageBox::Ok;
+  }
 
   // Create message box & set options
   QMessageBox box;
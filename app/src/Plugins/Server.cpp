@@ -19,6 +19,7 @@
  * SPDX-License-Identifier: GPL-3.0-or-later
  */
 
+#include <QDateTime>
 #include <QJsonArray>
 #include <QJsonObject>
 #include <QJsonDocument>
@@ -38,11 +39,16 @@ Plugins::Server::Server()
 {
 
   // Send processed data at 1 Hz
-  connect(&JSON::FrameBuilder::instance(), &JSON::FrameBuilder::frameChanged,
-          this, &Plugins::Server::registerFrame, Qt::QueuedConnection);
+  connect(&JSON::FrameBuilder::instance(), &JSON::FrameBuilder::framesChanged,
+          this, &Plugins::Server::registerFrames, Qt::QueuedConnection);
   connect(&Misc::TimerEvents::instance(), &Misc::TimerEvents::timeout1Hz, this,
           &Plugins::Server::sendProcessedData);
 
+  // Sample & send the pipeline counters at 1 Hz
+  m_statsTimer.start();
+  connect(&Misc::TimerEvents::instance(), &Misc::TimerEvents::timeout1Hz, this,
+          &Plugins::Server::sendStatistics);
+
   // Send I/O "raw" data directly
   connect(&IO::Manager::instance(), &IO::Manager::dataReceived, this,
           &Plugins::Server::sendRawData, Qt::QueuedConnection);
@@ -201,11 +207,114 @@ void Plugins::Server::acceptConnection()
   m_sockets.append(socket);
 }
 
+/**
+ * Samples the counters of the data pipeline and sends them to the plugins in
+ * a message with the following structure:
+ *
+ * @code
+ * {"stats": {"timestamp": 1718000000000, "bytesPerSecond": 11520, ...}}
+ * @endcode
+ *
+ * The message contains:
+ * - @c bytesReceived & @c bytesPerSecond: data received from the devices.
+ * - @c framesExtracted & @c framesPerSecond: frames found by the readers.
+ * - @c checksumErrors: frames rejected due to an invalid checksum.
+ * - @c skippedFrames: empty frames & finish sequences without a start.
+ * - @c framingErrors: malformed COBS/SLIP packets.
+ * - @c resyncCount: times a length-prefixed stream lost synchronization.
+ * - @c parseErrors: frames for which the frame parser function failed.
+ * - @c queuedFrames & @c queueCapacity: frames waiting to be parsed.
+ * - @c droppedFrames, @c droppedBytes & @c ingressDroppedBytes: data
+ *   discarded by the pipeline, see @c dropCounters().
+ *
+ * Rates are calculated from the previous sample, the other counters are
+ * cumulative since the device was connected.
+ */
+void Plugins::Server::sendStatistics()
+{
+  // Sample the pipeline counters
+  const auto &manager = IO::Manager::instance();
+  const auto stats = manager.statistics();
+  const auto elapsed = m_statsTimer.restart();
+
+  // Calculate rates, counters restart from zero when a device is connected
+  auto rate = [elapsed](const quint64 current, const quint64 previous) {
+    if (elapsed <= 0 || current < previous)
+      return 0.0;
+
+    return static_cast<double>(current - previous) * 1000.0 / elapsed;
+  };
+
+  const auto bytesPerSecond
+      = rate(stats.bytesReceived, m_lastStats.bytesReceived);
+  const auto framesPerSecond
+      = rate(stats.framesExtracted, m_lastStats.framesExtracted);
+  m_lastStats = stats;
+
+  // Stop if system is not enabled
+  if (!enabled())
+    return;
+
+  // Stop if no sockets are available
+  if (m_sockets.count() < 1)
+    return;
+
+  // Create JSON object with the counters
+  const auto parseErrors = JSON::FrameBuilder::instance().parseErrors();
+  const auto timestamp = QDateTime::currentMSecsSinceEpoch();
+  QJsonObject counters;
+  counters.insert(QStringLiteral("timestamp"), timestamp);
+  counters.insert(QStringLiteral("bytesPerSecond"), bytesPerSecond);
+  counters.insert(QStringLiteral("framesPerSecond"), framesPerSecond);
+  counters.insert(QStringLiteral("bytesReceived"),
+                  static_cast<qint64>(stats.bytesReceived));
+  counters.insert(QStringLiteral("framesExtracted"),
+                  static_cast<qint64>(stats.framesExtracted));
+  counters.insert(QStringLiteral("checksumErrors"),
+                  static_cast<qint64>(stats.checksumErrors));
+  counters.insert(QStringLiteral("skippedFrames"),
+                  static_cast<qint64>(stats.skippedFrames));
+  counters.insert(QStringLiteral("framingErrors"),
+                  static_cast<qint64>(stats.framingErrors));
+  counters.insert(QStringLiteral("resyncCount"),
+                  static_cast<qint64>(stats.resyncCount));
+  counters.insert(QStringLiteral("parseErrors"),
+                  static_cast<qint64>(parseErrors));
+  counters.insert(QStringLiteral("queuedFrames"),
+                  static_cast<qint64>(stats.queuedFrames));
+  counters.insert(QStringLiteral("queueCapacity"), manager.queueCapacity());
+  counters.insert(QStringLiteral("droppedFrames"),
+                  static_cast<qint64>(stats.droppedFrames));
+  counters.insert(QStringLiteral("droppedBytes"),
+                  static_cast<qint64>(stats.droppedBytes));
+  counters.insert(QStringLiteral("ingressDroppedBytes"),
+                  static_cast<qint64>(stats.ingressDroppedBytes));
+
+  // Get JSON string in compact format
+  QJsonObject object;
+  object.insert(QStringLiteral("stats"), counters);
+  const QJsonDocument document(object);
+  const auto json = document.toJson(QJsonDocument::Compact) + "\n";
+
+  // Send data to each plugin
+  Q_FOREACH (auto socket, m_sockets)
+  {
+    if (!socket)
+      continue;
+
+    if (socket->isWritable())
+      socket->write(json);
+  }
+}
+
 /**
  * Sends an array of frames with the following information:
  * - Frame ID number
  * - RX timestamp
  * - Frame JSON data
+ *
+ * The message also contains a @c drops object with the number of frames and
+ * bytes discarded by each pipeline stage since the device was connected.
  */
 void Plugins::Server::sendProcessedData()
 {
@@ -237,6 +346,7 @@ void Plugins::Server::sendProcessedData()
     // Construct QByteArray with data
     QJsonObject object;
     object.insert(QStringLiteral("frames"), array);
+    object.insert(QStringLiteral("drops"), dropCounters());
     const QJsonDocument document(object);
     auto json = document.toJson(QJsonDocument::Compact) + "\n";
 
@@ -256,6 +366,40 @@ void Plugins::Server::sendProcessedData()
   m_frames.squeeze();
 }
 
+/**
+ * Returns a JSON object with the number of frames and bytes discarded by each
+ * stage of the data pipeline:
+ * - @c ingress: received bytes dropped before frame extraction.
+ * - @c frameQueue: frames dropped between the frame reader and the dashboard.
+ * - @c parser: frames that could not be handed to the frame parser workers,
+ *   frames are held in the frame queue while the workers catch up.
+ */
+QJsonObject Plugins::Server::dropCounters() const
+{
+  const auto &manager = IO::Manager::instance();
+
+  QJsonObject ingress;
+  ingress.insert(QStringLiteral("bytes"),
+                 static_cast<qint64>(manager.ingressDroppedBytes()));
+
+  QJsonObject frameQueue;
+  frameQueue.insert(QStringLiteral("frames"),
+                    static_cast<qint64>(manager.droppedFrames()));
+  frameQueue.insert(QStringLiteral("bytes"),
+                    static_cast<qint64>(manager.droppedBytes()));
+
+  QJsonObject parser;
+  parser.insert(QStringLiteral("frames"),
+                static_cast<qint64>(
+                    JSON::FrameBuilder::instance().droppedFrames()));
+
+  QJsonObject object;
+  object.insert(QStringLiteral("ingress"), ingress);
+  object.insert(QStringLiteral("frameQueue"), frameQueue);
+  object.insert(QStringLiteral("parser"), parser);
+  return object;
+}
+
 /**
  * Encodes the given @a data in Base64 and sends it through the TCP socket
  * connected to the localhost.
@@ -290,13 +434,13 @@ void Plugins::Server::sendRawData(const QByteArray &data)
 }
 
 /**
- * Obtains the latest JSON dataframe & appends it to the JSON list, which is
+ * Obtains the latest JSON dataframes & appends them to the JSON list, which is
  * later read and sent by the @c sendProcessedData() function.
  */
-void Plugins::Server::registerFrame(const JSON::Frame &frame)
+void Plugins::Server::registerFrames(const JSON::FrameBatch &batch)
 {
   if (enabled())
-    m_frames.append(frame);
+    m_frames.append(batch.frames);
 }
 
 /**
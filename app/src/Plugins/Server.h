@@ -25,9 +25,12 @@
 #include <QTcpSocket>
 #include <QTcpServer>
 #include <QByteArray>
+#include <QJsonObject>
 #include <QHostAddress>
+#include <QElapsedTimer>
 
 #include "JSON/Frame.h"
+#include "IO/FrameReader.h"
 
 /**
  * Default TCP port to use for incoming connections, I choose 7777 because 7 is
@@ -51,6 +54,11 @@ namespace Plugins
  * A benefit of implementing plugins in this manner is that you can write your
  * Serial Studio companion application in any language and framework that you
  * desire, you do not have to force yourself to use Qt or C/C++.
+ *
+ * Once per second, plugins also receive a @c stats message with the counters
+ * of the data pipeline (throughput, errors, queue depth & dropped data), so
+ * that monitoring tools can track a running instance without a user
+ * interface.
  */
 class Server : public QObject
 {
@@ -80,15 +88,22 @@ public slots:
 private slots:
   void onDataReceived();
   void acceptConnection();
+  void sendStatistics();
   void sendProcessedData();
   void sendRawData(const QByteArray &data);
-  void registerFrame(const JSON::Frame &frame);
+  void registerFrames(const JSON::FrameBatch &batch);
   void onErrorOccurred(const QAbstractSocket::SocketError socketError);
 
+private:
+  [[nodiscard]] QJsonObject dropCounters() const;
+
 private:
   bool m_enabled;
   QTcpServer m_server;
   QVector<JSON::Frame> m_frames;
   QVector<QTcpSocket *> m_sockets;
+
+  QElapsedTimer m_statsTimer;
+  IO::FrameReaderStatistics m_lastStats;
 };
 } // namespace Plugins
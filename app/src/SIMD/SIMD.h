@@ -328,4 +328,75 @@ inline qreal findMax(const QVector<QPointF> &data, Extractor extractor)
 
   return maxVal;
 }
+
+/**
+ * @brief Finds the first byte in an array that matches any of the given
+ *        needle bytes using SIMD for parallel comparisons.
+ *
+ * This function compares 16 bytes at a time against every needle and merges
+ * the results into a single bit mask, so the array is traversed only once
+ * regardless of the number of needles.
+ *
+ * Remaining bytes that do not fit in the SIMD width are processed using a
+ * scalar fallback loop. Searches for more than 8 needles, which do not fit
+ * in the SIMD registers, use the scalar loop for the whole array.
+ *
+ * @param data Pointer to the array of bytes.
+ * @param count The total number of bytes in the array.
+ * @param needles Pointer to the bytes to search for.
+ * @param needleCount The number of needle bytes.
+ *
+ * @return The index of the first matching byte, or -1 if none was found.
+ */
+inline ptrdiff_t findFirstOf(const char *data, size_t count,
+                             const char *needles, size_t needleCount)
+{
+  // Obtain register width for SIMD operations
+  constexpr size_t maxNeedles = 8;
+  constexpr auto simdWidth = sizeof(simde__m128i);
+
+  // Broadcast each needle to a SIMD register
+  simde__m128i vectors[maxNeedles];
+  const bool vectorized = needleCount <= maxNeedles;
+  for (size_t n = 0; vectorized && n < needleCount; ++n)
+    vectors[n] = simde_mm_set1_epi8(needles[n]);
+
+  // SIMD comparisons
+  size_t i = 0;
+  for (; vectorized && i + simdWidth <= count; i += simdWidth)
+  {
+    auto block = simde_mm_loadu_si128(
+        reinterpret_cast<const simde__m128i *>(data + i));
+
+    auto hits = simde_mm_setzero_si128();
+    for (size_t n = 0; n < needleCount; ++n)
+      hits = simde_mm_or_si128(hits, simde_mm_cmpeq_epi8(block, vectors[n]));
+
+    // Locate the lowest matching lane
+    auto mask = static_cast<unsigned int>(simde_mm_movemask_epi8(hits));
+    if (mask != 0)
+    {
+      size_t lane = 0;
+      while ((mask & 1u) == 0)
+      {
+        mask >>= 1;
+        ++lane;
+      }
+
+      return static_cast<ptrdiff_t>(i + lane);
+    }
+  }
+
+  // Scalar fallback for remaining elements
+  for (; i < count; ++i)
+  {
+    for (size_t n = 0; n < needleCount; ++n)
+    {
+      if (data[i] == needles[n])
+        return static_cast<ptrdiff_t>(i);
+    }
+  }
+
+  return -1;
+}
 }; // namespace SIMD
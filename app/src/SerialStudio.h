@@ -96,8 +96,8 @@ typedef struct
  * Bluetooth LE devices.
  *
  * Key Features:
- * - **Decoding Methods**: Support for PlainText, Hexadecimal, and Base64
- *   decoding.
+ * - **Decoding Methods**: Support for PlainText, Hexadecimal, Base64 and
+ *   binary decoding.
  * - **Frame Detection**: Configurable methods for detecting data frames in
  *   streams, including end-delimiter-only and start-and-end-delimiter
  * strategies.
@@ -118,6 +118,8 @@ typedef struct
  * - **DecoderMethod**: Defines methods for decoding data streams.
  * - **FrameDetection**: Configures strategies for detecting frames in data
  *                       streams.
+ * - **ChecksumAlgorithm**: Selects how frame trailers are validated.
+ * - **ParserMethod**: Selects how the fields of project frames are obtained.
  * - **OperationMode**: Specifies methods for building dashboards.
  * - **BusType**: Enumerates the available data sources.
  * - **GroupWidget**: Lists visualization widget types for groups.
@@ -142,7 +144,8 @@ public:
   {
     PlainText,   /**< Standard decoding, interprets data as plain text. */
     Hexadecimal, /**< Decodes data assuming a hexadecimal-encoded format. */
-    Base64       /**< Decodes data assuming a Base64-encoded format. */
+    Base64,      /**< Decodes data assuming a Base64-encoded format. */
+    Binary,      /**< Passes the raw bytes to the parser as a Uint8Array. */
     /* IMPORTANT: When adding other modes, please don't modify the order of the
      *            enums to ensure backward compatiblity with previous project
      *            files!! */
@@ -163,7 +166,10 @@ public:
     EndDelimiterOnly     = 0x00, /**< Detects frames based only on an end delimiter. */
     StartAndEndDelimiter = 0x01, /**< Detects frames based on both start and end delimiters. */
     NoDelimiters         = 0x02, /**< Disables frame detection and processes incoming data directly */
-    StartDelimiterOnly   = 0x03  /**< Detects frames with only a header */
+    StartDelimiterOnly   = 0x03, /**< Detects frames with only a header */
+    LengthPrefixed       = 0x04, /**< Detects binary frames with a sync word & a length field */
+    COBS                 = 0x05, /**< Detects COBS-encoded binary frames ending with 0x00 */
+    SLIP                 = 0x06  /**< Detects SLIP-encoded binary frames ending with 0xC0 */
     /* IMPORTANT: When adding other modes, please don't modify the order of the
      *            enums to ensure backward compatiblity with previous project
      *            files!! */
@@ -171,6 +177,46 @@ public:
   Q_ENUM(FrameDetection)
   // clang-format on
 
+  /**
+   * @enum ChecksumAlgorithm
+   * @brief Specifies the checksum trailer expected after each frame delimiter.
+   *
+   * The trailer consists of a textual header (e.g. `crc16:`) followed by the
+   * checksum of the frame in big-endian byte order.
+   */
+  enum ChecksumAlgorithm
+  {
+    AutoDetectChecksum, /**< Uses the first trailer received, if any. */
+    NoChecksum,         /**< Frames do not carry a checksum trailer. */
+    CRC8,               /**< `crc8:` header followed by 1 byte. */
+    CRC16,              /**< `crc16:` header followed by 2 bytes. */
+    CRC32,              /**< `crc32:` header followed by 4 bytes. */
+    CRC16Modbus,        /**< `modbus:` header followed by 2 bytes. */
+    CRC32C,             /**< `crc32c:` header followed by 4 bytes. */
+    Fletcher16,         /**< `fletcher16:` header followed by 2 bytes. */
+    XOR8,               /**< `xor8:` header followed by 1 byte. */
+    Sum8,               /**< `sum8:` header followed by 1 byte. */
+    /* IMPORTANT: When adding other modes, please don't modify the order of the
+     *            enums to ensure backward compatiblity with previous project
+     *            files!! */
+  };
+  Q_ENUM(ChecksumAlgorithm)
+
+  /**
+   * @enum ParserMethod
+   * @brief Specifies how the fields of a frame are obtained in project mode.
+   */
+  enum ParserMethod
+  {
+    ScriptParser,    /**< Runs the JavaScript frame parser function. */
+    NativeSeparator, /**< Splits the frame natively with a separator. */
+    BinaryStruct,    /**< Decodes binary fields at fixed positions. */
+    /* IMPORTANT: When adding other modes, please don't modify the order of the
+     *            enums to ensure backward compatiblity with previous project
+     *            files!! */
+  };
+  Q_ENUM(ParserMethod)
+
   /**
    * @enum OperationMode
    * @brief Specifies the method used to construct a dashboard.
@@ -190,6 +236,19 @@ public:
   };
   Q_ENUM(OperationMode)
 
+  /**
+   * @enum BackpressurePolicy
+   * @brief Specifies what happens when a bounded queue between two pipeline
+   *        stages is full.
+   */
+  enum BackpressurePolicy
+  {
+    Block,      /**< Stops the producer until the consumer catches up. */
+    DropOldest, /**< Discards the oldest queued frames to make room. */
+    KeepLatest, /**< Discards everything but the most recent frame. */
+  };
+  Q_ENUM(BackpressurePolicy)
+
   /**
    * @enum BusType
    * @brief Enumerates the available data sources for communication.
@@ -203,6 +262,7 @@ public:
     UART,        /**< Serial port communication. */
     Network,     /**< Network socket communication. */
     BluetoothLE, /**< Bluetooth Low Energy communication. */
+    Replay,      /**< Replay of a raw data capture. */
 #ifdef USE_QT_COMMERCIAL
     ModBus, /**< MODBUS communication */
     CanBus, /**< CANBUS communication */
@@ -26,6 +26,7 @@
 #include "IO/Console.h"
 #include "CSV/Player.h"
 #include "Misc/TimerEvents.h"
+#include "Misc/LatencyMonitor.h"
 #include "JSON/FrameBuilder.h"
 
 #ifdef USE_QT_COMMERCIAL
@@ -52,7 +53,7 @@ UI::Dashboard::Dashboard()
   connect(&CSV::Player::instance(), &CSV::Player::openChanged, this, [=] { resetData(true); }, Qt::QueuedConnection);
   connect(&IO::Manager::instance(), &IO::Manager::connectedChanged, this, [=] { resetData(true); }, Qt::QueuedConnection);
   connect(&JSON::FrameBuilder::instance(), &JSON::FrameBuilder::jsonFileMapChanged, this, [=] { resetData(); }, Qt::QueuedConnection);
-  connect(&JSON::FrameBuilder::instance(), &JSON::FrameBuilder::frameChanged, this, &UI::Dashboard::processFrame, Qt::QueuedConnection);
+  connect(&JSON::FrameBuilder::instance(), &JSON::FrameBuilder::framesChanged, this, &UI::Dashboard::processFrames, Qt::QueuedConnection);
   // clang-format on
 
   // Reset dashboard data if MQTT client is subscribed
@@ -78,6 +79,11 @@ UI::Dashboard::Dashboard()
         {
           m_updateRequired = false;
           Q_EMIT updated();
+
+          // Measure the render latency with the next frame of the window
+          auto &monitor = Misc::LatencyMonitor::instance();
+          monitor.recordOnNextRender(m_renderTimestamps);
+          m_renderTimestamps.clear();
         }
       },
       Qt::QueuedConnection);
@@ -574,6 +580,7 @@ void UI::Dashboard::resetData(const bool notify)
 
   // Reset frame data
   m_currentFrame = JSON::Frame();
+  m_renderTimestamps.clear();
 
   // Notify user interface
   if (notify)
@@ -612,11 +619,25 @@ void UI::Dashboard::setTerminalEnabled(const bool enabled)
  * from the datasets. It handles reinitialization if the widget count changes
  * and shifts data to accommodate new samples.
  *
+ * Only the plots of datasets that read from the given data @a source register
+ * a new sample, so that plots of devices with different frame rates keep one
+ * sample per frame of their own device.
+ *
  * @note This function is typically called in real-time to keep plots
  *       synchronized with incoming data.
  */
-void UI::Dashboard::updatePlots()
+void UI::Dashboard::updatePlots(const int source)
 {
+  // Checks if a dataset reads from the data source of its group
+  const auto &groups = m_currentFrame.groups();
+  const auto fromSource = [source, &groups](const JSON::Dataset &dataset) {
+    const auto id = dataset.groupId();
+    if (id < 0 || id >= groups.count())
+      return source == 0;
+
+    return groups.at(id).sourceId() == source;
+  };
+
   // Check if we need to re-initialize FFT plots data
   if (m_fftValues.count() != widgetCount(SerialStudio::DashboardFFT))
     configureFftSeries();
@@ -648,6 +669,9 @@ void UI::Dashboard::updatePlots()
   for (int i = 0; i < widgetCount(SerialStudio::DashboardFFT); ++i)
   {
     const auto &dataset = getDatasetWidget(SerialStudio::DashboardFFT, i);
+    if (!fromSource(dataset))
+      continue;
+
     auto *data = m_fftValues[i].data();
     auto count = m_fftValues[i].count();
     SIMD::shift<qreal>(data, count, dataset.value().toDouble());
@@ -658,8 +682,12 @@ void UI::Dashboard::updatePlots()
   QSet<int> yAxesMoved;
   for (int i = 0; i < widgetCount(SerialStudio::DashboardPlot); ++i)
   {
-    // Shift Y-axis points
+    // Skip plots of other data sources
     const auto &yDataset = getDatasetWidget(SerialStudio::DashboardPlot, i);
+    if (!fromSource(yDataset))
+      continue;
+
+    // Shift Y-axis points
     if (!yAxesMoved.contains(yDataset.index()))
     {
       yAxesMoved.insert(yDataset.index());
@@ -684,6 +712,9 @@ void UI::Dashboard::updatePlots()
   for (int i = 0; i < widgetCount(SerialStudio::DashboardMultiPlot); ++i)
   {
     const auto &group = getGroupWidget(SerialStudio::DashboardMultiPlot, i);
+    if (group.sourceId() != source)
+      continue;
+
     for (int j = 0; j < group.datasetCount(); ++j)
     {
       const auto &dataset = group.datasets()[j];
@@ -697,12 +728,16 @@ void UI::Dashboard::updatePlots()
 #ifdef USE_QT_COMMERCIAL
   for (int i = 0; i < widgetCount(SerialStudio::DashboardPlot3D); ++i)
   {
+    // Skip plots of other data sources
+    const auto &group = getGroupWidget(SerialStudio::DashboardPlot3D, i);
+    if (group.sourceId() != source)
+      continue;
+
     // Get pointer to vector with 3D points for current widget
     auto &plotData = m_plotData3D[i];
 
     // Initialize new point
     QVector3D point;
-    const auto &group = getGroupWidget(SerialStudio::DashboardPlot3D, i);
     for (int j = 0; j < group.datasetCount(); ++j)
     {
       const auto &dataset = group.datasets()[j];
@@ -902,9 +937,10 @@ void UI::Dashboard::configureMultiLineSeries()
  * - Calls `updatePlots()` to ensure plotting data aligns with the new frame.
  * - Notifies the application about the updated frame.
  *
- * @param frame The new JSON::Frame to process for the dashboard.
+ * @param frame  The new JSON::Frame to process for the dashboard.
+ * @param source The data source whose groups were updated by the frame.
  */
-void UI::Dashboard::processFrame(const JSON::Frame &frame)
+void UI::Dashboard::processFrame(const JSON::Frame &frame, const int source)
 {
   // Validate frame
   if (!frame.isValid() || !streamAvailable())
@@ -1091,5 +1127,44 @@ void UI::Dashboard::processFrame(const JSON::Frame &frame)
   }
 
   // Update plot data
-  updatePlots();
+  updatePlots(source);
+}
+
+/**
+ * @brief Processes a batch of frames received from the frame builder.
+ *
+ * Every frame is fed to `processFrame()` in order, so that plots register one
+ * sample per frame, while the whole batch only costs a single event. Only the
+ * frames that were processed are measured, so that rejected frames never
+ * pile up waiting for a redraw that will not happen.
+ *
+ * @param batch The frames built from the latest batch of raw frames.
+ */
+void UI::Dashboard::processFrames(const JSON::FrameBatch &batch)
+{
+  // The frames are not displayed, nothing to process or measure
+  if (!streamAvailable())
+    return;
+
+  // Process the valid frames & keep their ingress timestamps
+  QVector<qint64> timestamps;
+  timestamps.reserve(batch.timestamps.size());
+  for (qsizetype i = 0; i < batch.frames.size(); ++i)
+  {
+    const auto &frame = batch.frames.at(i);
+    if (!frame.isValid())
+      continue;
+
+    processFrame(frame, batch.source);
+    timestamps.append(batch.timestamps.at(i));
+  }
+
+  // Measure the dashboard latency, the render latency is measured once the
+  // widgets have been notified & the window has been redrawn
+  if (timestamps.isEmpty())
+    return;
+
+  Misc::LatencyMonitor::instance().record(Misc::LatencyMonitor::Dashboard,
+                                          timestamps);
+  m_renderTimestamps.append(timestamps);
 }
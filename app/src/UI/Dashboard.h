@@ -137,11 +137,12 @@ public slots:
   void setTerminalEnabled(const bool enabled);
 
 private slots:
-  void updatePlots();
+  void updatePlots(const int source = 0);
   void configureFftSeries();
   void configureLineSeries();
   void configureMultiLineSeries();
-  void processFrame(const JSON::Frame &frame);
+  void processFrame(const JSON::Frame &frame, const int source = 0);
+  void processFrames(const JSON::FrameBatch &batch);
 
 private:
   int m_points;
@@ -170,5 +171,6 @@ private:
   QMap<SerialStudio::DashboardWidget, QVector<JSON::Dataset>> m_widgetDatasets;
 
   JSON::Frame m_currentFrame;
+  QVector<qint64> m_renderTimestamps;
 };
 } // namespace UI
@@ -19,7 +19,6 @@
  * SPDX-License-Identifier: GPL-3.0-or-later
  */
 
-#include <QThread>
 #include <QSysInfo>
 #include <QSettings>
 #include <QQuickStyle>
@@ -27,6 +26,7 @@
 #include <QStyleFactory>
 
 #include "AppInfo.h"
+#include "Misc/Headless.h"
 #include "Misc/ModuleManager.h"
 
 #ifdef Q_OS_WIN
@@ -79,12 +79,20 @@ int main(int argc, char **argv)
   QApplication::setApplicationDisplayName(APP_NAME);
   QApplication::setOrganizationDomain(APP_SUPPORT_URL);
 
+  // Attach to the console to show log output
+#ifdef Q_OS_WIN
+  attachToConsole();
+#endif
+
+  // Run the data pipeline without user interface
+  if (Misc::Headless::requested(argc, argv))
+    return Misc::Headless::exec(argc, argv);
+
   // Disable native menubar
   QApplication::setAttribute(Qt::AA_DontUseNativeMenuBar);
 
   // Windows specific initialization code
 #ifdef Q_OS_WIN
-  attachToConsole();
   argv = adjustArgumentsForFreeType(argc, argv);
 #endif
 
@@ -101,9 +109,6 @@ int main(int argc, char **argv)
   // Initialize application
   QApplication app(argc, argv);
 
-  // Set thread priority
-  QThread::currentThread()->setPriority(QThread::HighestPriority);
-
   // Set application style
   app.setStyle(QStyleFactory::create("Fusion"));
   QQuickStyle::setStyle("Fusion");